@@ -6,6 +6,9 @@
 #endif /* __cplusplus */
 
 void debug_console_init(void);
+#ifdef MENU_USE_TRACE
+void debug_menu_trace_dump(void);
+#endif
 
 #ifdef __cplusplus
 }
@@ -1,7 +1,14 @@
 #include <stdio.h>
 #include <avr/io.h>
+#include "debug.h"
+#ifdef MENU_USE_TRACE
+#include "menu_lib.h"
+#endif
 
 static int uart_putchar(char c, FILE *stream);
+#ifdef MENU_USE_TRACE
+static void debug_write_trace_bytes(const uint8_t *data, uint16_t len);
+#endif
 
 static FILE mystdout = FDEV_SETUP_STREAM(uart_putchar, NULL, _FDEV_SETUP_WRITE);
 
@@ -29,4 +36,22 @@ static int uart_putchar(char c, FILE *stream) {
     // Put data into buffer, sends the data
     UDR0 = c;
     return 0;
-}
\ No newline at end of file
+}
+
+#ifdef MENU_USE_TRACE
+/* Hex dump of the menu trace ring, decode it on the host with lib/MENU_LIB/tools/menu_trace_decode.py */
+void debug_menu_trace_dump(void)
+{
+    printf("MENU TRACE:\n");
+    menu_trace_dump(debug_write_trace_bytes);
+    printf("\n");
+}
+
+static void debug_write_trace_bytes(const uint8_t *data, uint16_t len)
+{
+    for (uint16_t i = 0; i < len; i++)
+    {
+        printf("%02X ", data[i]);
+    }
+}
+#endif
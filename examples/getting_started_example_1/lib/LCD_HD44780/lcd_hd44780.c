@@ -13,6 +13,7 @@
 #include "lcd_hd44780_driver_commands.h"
 #ifdef AVR
 #include "lcd_hd44780_avr_specific.h"
+#include <avr/pgmspace.h>
 #endif
 #include <stddef.h>
 #include <stdio.h>
@@ -20,6 +21,17 @@
 
 #define BUSY_FLAG 1 << 7
 #define VAL_PREFIX_LENGHT 2U
+#if LCD_ADAPTIVE_TIMING == ON
+/* Worst case execution times: datasheet values at fosc = 270 kHz scaled to the 190 kHz low end of the oscillator */
+#define LCD_DATA_EXEC_US 59U         /* data write incl. address counter update, 41 us at 270 kHz */
+#define LCD_CMD_EXEC_US 53U          /* set DDRAM/CGRAM address, entry mode, display on/off, function set, 37 us */
+#define LCD_CLEAR_HOME_EXEC_US 2160U /* clear display, return home, 1.52 ms */
+#else
+#define LCD_DATA_EXEC_US 120U /* fixed delay per byte when the busy flag is not read */
+#define LCD_CMD_EXEC_US 120U
+#define LCD_CLEAR_HOME_EXEC_US 5020U /* fixed delay + 4900 us */
+#endif
+#define LCD_INIT_STEPS_QTY (sizeof(lcd_init_steps) / sizeof(lcd_init_steps[0]))
 
 #ifndef UNIT_TEST
 #define PRIVATE static
@@ -30,11 +42,61 @@
 #if LCD_BUFFERING == ON
 #define LAST_CHAR_IN_LCD_LINE (LCD_X - 1)
 #define LAST_LCD_LINE (LCD_Y - 1)
+#define LCD_BUF_SIZE ((uint16_t)LCD_X * LCD_Y)
+#define LCD_FLUSH_MIN_BUDGET 2U /* cursor relocation + one character, smaller budgets are raised to it */
+#define LCD_ADDRESS_UNKNOWN 0xFFU
+#define LCD_DDRAM_ADDRESS_MASK 0x7FU
+#define LCD_DDRAM_LINE1_END 0x28U /* 2-line mode: the address counter moves from 0x27 to 0x40 and from 0x67 to 0x00 */
+#define LCD_DDRAM_LINE2_START 0x40U
+#define LCD_DDRAM_LINE2_END 0x68U
+
+/* Flush planner cost model: bus time in us of a cursor relocation (set DDRAM address command) and of one rewritten
+ * character. A gap of unchanged cells between two changed ones is rewritten through the DDRAM auto-increment when
+ * gap * LCD_FLUSH_CHAR_COST <= LCD_FLUSH_RELOCATE_COST, otherwise the cursor is relocated. */
+#ifndef LCD_FLUSH_RELOCATE_COST
+#if (LCD_TRANSPORT == LCD_TRANSPORT_I2C) && (USE_RW_PIN == ON)
+#define LCD_FLUSH_RELOCATE_COST 1800U /* 18 expander writes of ~100 us, RS is already low after the busy flag read */
+#define LCD_FLUSH_CHAR_COST 1900U     /* the same + RS set for data */
+#elif LCD_TRANSPORT == LCD_TRANSPORT_I2C
+#define LCD_FLUSH_RELOCATE_COST (800U + LCD_CMD_EXEC_US) /* 6 nibble writes + RS low and back high (~100 us each) + delay */
+#define LCD_FLUSH_CHAR_COST (600U + LCD_DATA_EXEC_US)    /* 6 nibble writes + delay */
+#elif USE_RW_PIN == ON
+#define LCD_FLUSH_RELOCATE_COST 37U /* set DDRAM address execution time, the busy flag is polled */
+#define LCD_FLUSH_CHAR_COST 41U     /* data write execution time */
+#else
+#define LCD_FLUSH_RELOCATE_COST LCD_CMD_EXEC_US /* delay per byte, a relocation also switches RS twice */
+#define LCD_FLUSH_CHAR_COST LCD_DATA_EXEC_US
+#endif
+#endif
+#define LCD_FLUSH_MAX_REWRITTEN_GAP (LCD_FLUSH_RELOCATE_COST / LCD_FLUSH_CHAR_COST)
 
 typedef char lcd_pos_t;
 static lcd_pos_t *lcd_buf_position_ptr;
 PRIVATE char lcd_buffer[LCD_Y][LCD_X];
 PRIVATE char prev_lcd_buffer[LCD_Y][LCD_X];
+static uint8_t lcd_dirty_begin[LCD_Y];       /* first column of each line written since the flush pass started */
+static uint8_t lcd_dirty_end[LCD_Y];         /* column after the last written one, not above lcd_dirty_begin for a clean line */
+static uint8_t lcd_flush_begin[LCD_Y];       /* columns of each line compared by the flush pass */
+static uint8_t lcd_flush_end[LCD_Y];         /* column after the last one compared by the flush pass */
+static uint8_t lcd_flush_line = 0;           /* line of the next cell compared by the flush pass */
+static uint8_t lcd_flush_column = 0;         /* column of the next cell compared by the flush pass */
+static bool lcd_flush_in_progress = false;   /* flush pass started and not finished yet */
+static uint8_t lcd_address_counter = LCD_ADDRESS_UNKNOWN; /* DDRAM address of the LCD cursor */
+
+static const uint8_t lcd_line_address[LCD_Y] = {
+    LCD_LINE1_ADR,
+#if (LCD_Y > 1)
+    LCD_LINE2_ADR,
+#endif
+#if (LCD_Y > 2)
+    LCD_LINE3_ADR,
+#endif
+#if (LCD_Y > 3)
+    LCD_LINE4_ADR,
+#endif
+};
+
+typedef uint32_t lcd_word_t; /* unit of the unchanged cells skipped by the flush pass */
 #endif
 
 static const struct LCD_IO_driver_interface_struct *LCD = NULL;
@@ -42,18 +104,58 @@ static const struct LCD_IO_driver_interface_struct *LCD = NULL;
 static const lcd_char_mapping_struct_t *char_mapping_tab = NULL;
 #endif
 PRIVATE bool LCD_BUFFER_UPDATE_FLAG = false;
+static bool lcd_rs_known = false; /* lcd_rs_high is the state of the RS pin */
+static bool lcd_rs_high = false;
+PRIVATE bool lcd_ready = false; /* init sequence finished, the controller accepts commands */
+static uint32_t (*lcd_get_time_us)(void) = NULL;
+PRIVATE uint8_t lcd_init_next_step = 0U; /* 0 until lcd_init_start() or lcd_init() is called */
+static uint32_t lcd_init_step_time_us = 0U; /* lcd_get_time_us() value when the last init step was sent */
+#if LCD_ADAPTIVE_TIMING == ON
+static uint16_t lcd_exec_us = 0U;       /* worst case execution time of the last byte not waited for yet, 0 if none */
+static uint32_t lcd_exec_start_us = 0U; /* lcd_get_time_us() value when the last byte was sent */
+#endif
+
+typedef struct
+{
+    void (*action)(void);
+    uint16_t wait_us; /* time the controller needs after the step */
+    bool busy_flag;   /* command step, lcd_init() polls the busy flag instead of waiting wait_us when the RW pin is used */
+} lcd_init_step_t;
 
 static void register_LCD_IO_driver(void);
 static void lcd_set_all_SIG(void);
 static void lcd_reset_all_SIG(void);
 static void lcd_write_4bit_data(uint8_t data);
 static void lcd_write_cmd(uint8_t cmd);
+static void lcd_send_cmd(uint8_t cmd);
 static void lcd_write_data(uint8_t data);
-static void lcd_write_byte(uint8_t byte);
+static void lcd_send_byte(uint8_t byte);
+static void lcd_start_exec(uint16_t exec_us);
+static void lcd_wait_exec_end(void);
+#if (USE_RW_PIN == ON) || (LCD_ADAPTIVE_TIMING == OFF)
+static void lcd_wait_ready(void);
+#endif
+#if LCD_ADAPTIVE_TIMING == ON
+static uint16_t get_lcd_cmd_exec_us(uint8_t cmd);
+#endif
+static void lcd_set_RS(bool high);
+static void lcd_init_power_up(void);
+static void lcd_init_first_wake_up(void);
+static void lcd_init_wake_up(void);
+static void lcd_init_set_4bit_mode(void);
+static void lcd_init_function_set(void);
+static void lcd_init_display_on(void);
+static void lcd_init_clear(void);
+static void lcd_init_entry_mode(void);
+static void wait_lcd_init_step(const lcd_init_step_t *step);
+static void run_lcd_init_step(void);
+static bool is_lcd_init_step_pending(const lcd_init_step_t *step);
+static void reset_lcd_buffers(void);
 
 #if USE_RW_PIN == ON
 static uint8_t lcd_read_byte(void);
 static uint8_t lcd_read_4bit_data(void);
+static bool lcd_read_busy_flag(void);
 #endif
 
 #ifndef AVR
@@ -66,8 +168,15 @@ static void fill_zeros_buffer(const char *buffer, uint8_t width, char *zeros_buf
 #if LCD_BUFFERING == ON
 static void check_lcd_buf_possition_ptr_overflow(void);
 static void copy_lcd_buf_2_prev_lcd_buf(void);
-static void update_lcd_curosr_possition(uint8_t *lcd_cursor_position, uint8_t *lcd_line, uint8_t *missed_char_counter_in_LCD_line);
-static void write_lcd_buf_2_lcd(const uint8_t *lcd_cursor_position, const uint8_t *lcd_line, uint8_t *missed_char_counter_in_LCD_line, const lcd_pos_t *prev_lcd_buff_pos_ptr);
+static void mark_lcd_buf_dirty(const lcd_pos_t *first, uint16_t len);
+static void clear_lcd_dirty_lines(void);
+static void start_lcd_flush(void);
+static void seek_lcd_flush_line(uint8_t line);
+static uint8_t skip_unchanged_lcd_cells(uint8_t line, uint8_t column, uint8_t end);
+static uint8_t get_lcd_flush_gap(uint8_t line, uint8_t column);
+static bool flush_lcd_buf_cell(uint8_t *budget);
+static void rewrite_lcd_buf_cells(uint8_t line, uint8_t column, uint8_t end);
+static void track_lcd_address_counter(uint8_t cmd);
 #endif
 #if USE_DEF_CHAR_FUNCTION == ON
 char lcd_translate_char(char c);
@@ -82,6 +191,8 @@ static void lcd_set_all_SIG(void)
 {
     LCD->set_LCD_E();
     LCD->set_LCD_RS();
+    lcd_rs_known = true;
+    lcd_rs_high = true;
 #if USE_RW_PIN == ON
     LCD->set_LCD_RW();
 #endif
@@ -94,6 +205,7 @@ static void lcd_reset_all_SIG(void)
 #endif
     LCD->reset_LCD_RS();
     LCD->reset_LCD_E();
+    lcd_rs_high = false;
 }
 
 void lcd_write_4bit_data(uint8_t data)
@@ -106,21 +218,74 @@ void lcd_write_4bit_data(uint8_t data)
     ;
 }
 
+/**
+ * @brief Drive the RS pin, the pin is not written again when it already has the requested state.
+ */
+static void lcd_set_RS(bool high)
+{
+    if ((lcd_rs_known == false) || (lcd_rs_high != high))
+    {
+        if (high == true)
+        {
+            LCD->set_LCD_RS();
+        }
+        else
+        {
+            LCD->reset_LCD_RS();
+        }
+        lcd_rs_known = true;
+        lcd_rs_high = high;
+    }
+}
+
 static void lcd_write_cmd(uint8_t cmd)
 {
-    LCD->reset_LCD_RS();
+    lcd_wait_exec_end();
+    lcd_send_cmd(cmd);
+#if LCD_ADAPTIVE_TIMING == ON
+    lcd_start_exec(get_lcd_cmd_exec_us(cmd));
+#else
+    lcd_start_exec(LCD_CMD_EXEC_US);
+#endif
+}
+
+/**
+ * @brief Send a command without waiting for its execution, the caller waits before the next transfer.
+ */
+static void lcd_send_cmd(uint8_t cmd)
+{
+    lcd_set_RS(false);
     ;
-    lcd_write_byte(cmd);
+    lcd_send_byte(cmd);
+#if LCD_BUFFERING == ON
+    track_lcd_address_counter(cmd);
+#endif
 }
 
 void lcd_write_data(uint8_t data)
 {
-    LCD->set_LCD_RS();
+    lcd_wait_exec_end();
+    lcd_set_RS(true);
     ;
-    lcd_write_byte(data);
+    lcd_send_byte(data);
+    lcd_start_exec(LCD_DATA_EXEC_US);
+#if LCD_BUFFERING == ON
+    if (lcd_address_counter != LCD_ADDRESS_UNKNOWN)
+    {
+        lcd_address_counter = (lcd_address_counter + 1U) & LCD_DDRAM_ADDRESS_MASK;
+        if (lcd_address_counter == LCD_DDRAM_LINE1_END)
+        {
+            lcd_address_counter = LCD_DDRAM_LINE2_START;
+        }
+        else if (lcd_address_counter == LCD_DDRAM_LINE2_END)
+        {
+            lcd_address_counter = 0U;
+        }
+    }
+#endif
 }
 
-void lcd_write_byte(uint8_t byte)
+static void lcd_send_byte(uint8_t byte)
 {
 #if USE_RW_PIN == ON
     LCD->reset_LCD_RW();
@@ -128,10 +293,80 @@ void lcd_write_byte(uint8_t byte)
 #endif
     lcd_write_4bit_data((byte) >> 4);
     lcd_write_4bit_data((byte) & 0x0F);
+}
+
+/**
+ * @brief Wait for the execution of the byte sent to the LCD.
+ * With LCD_ADAPTIVE_TIMING the wait is deferred to the next transfer (lcd_wait_exec_end()) when a time source is set,
+ * so the time spent between two transfers is not waited again. Otherwise the LCD is waited for right away.
+ * @param exec_us Worst case execution time of the sent byte.
+ */
+static void lcd_start_exec(uint16_t exec_us)
+{
+#if LCD_ADAPTIVE_TIMING == ON
+#if USE_RW_PIN == OFF
+    if (lcd_get_time_us == NULL)
+    {
+        LCD->delay_us(exec_us);
+        exec_us = 0U;
+    }
+#endif
+    if (lcd_get_time_us != NULL)
+    {
+        lcd_exec_start_us = lcd_get_time_us();
+    }
+    lcd_exec_us = exec_us;
+#else
+    (void)exec_us;
+    lcd_wait_ready();
+#endif
+}
+
+/**
+ * @brief Wait for the end of the byte sent by the last lcd_start_exec() call, before the next transfer.
+ * The busy flag is not polled and no delay is made when the worst case execution time has already elapsed.
+ */
+static void lcd_wait_exec_end(void)
+{
+#if LCD_ADAPTIVE_TIMING == ON
+    if (lcd_exec_us != 0U)
+    {
+        uint32_t elapsed_us = 0U; /* unknown without a time source */
+
+        if (lcd_get_time_us != NULL)
+        {
+            elapsed_us = lcd_get_time_us() - lcd_exec_start_us;
+        }
+        if (elapsed_us < lcd_exec_us)
+        {
+#if USE_RW_PIN == ON
+            lcd_wait_ready();
+#else
+            LCD->delay_us(lcd_exec_us - elapsed_us);
+#endif
+        }
+        lcd_exec_us = 0U;
+    }
+#endif
+}
+
+#if LCD_ADAPTIVE_TIMING == ON
+static uint16_t get_lcd_cmd_exec_us(uint8_t cmd)
+{
+    return (cmd < LCDC_ENTRY_MODE) ? LCD_CLEAR_HOME_EXEC_US : LCD_CMD_EXEC_US;
+}
+#endif
+
+#if (USE_RW_PIN == ON) || (LCD_ADAPTIVE_TIMING == OFF)
+/**
+ * @brief Wait until the LCD executes the last transfer: busy flag polling or the worst case execution time.
+ */
+static void lcd_wait_ready(void)
+{
 #if USE_RW_PIN == ON
     // check_BUSSY_FALG
     LCD->set_data_pins_as_inputs();
-    LCD->reset_LCD_RS();
+    lcd_set_RS(false);
     ;
     LCD->set_LCD_RW();
     ;
@@ -143,9 +378,10 @@ void lcd_write_byte(uint8_t byte)
     LCD->set_data_pins_as_outputs();
 
 #else
-    LCD->delay_us(120);
+    LCD->delay_us(LCD_CMD_EXEC_US);
 #endif
 }
+#endif
 
 #if USE_RW_PIN == ON
 uint8_t lcd_read_byte(void)
@@ -168,6 +404,25 @@ uint8_t lcd_read_4bit_data(void)
     ;
     return data;
 }
+
+/**
+ * @brief Read the busy flag once without waiting for the end of the execution.
+ */
+static bool lcd_read_busy_flag(void)
+{
+    bool busy;
+
+    LCD->set_data_pins_as_inputs();
+    lcd_set_RS(false);
+    ;
+    LCD->set_LCD_RW();
+    ;
+    busy = ((lcd_read_byte() & BUSY_FLAG) != 0U);
+    LCD->reset_LCD_RW();
+    ;
+    LCD->set_data_pins_as_outputs();
+    return busy;
+}
 #endif
 #ifndef AVR
 #if USE_LCD_BIN == ON
@@ -217,44 +472,194 @@ static void check_lcd_buf_possition_ptr_overflow(void)
 }
 static void copy_lcd_buf_2_prev_lcd_buf(void)
 {
-    for (uint8_t y = 0; y < LCD_Y; y++)
+    memcpy(prev_lcd_buffer, lcd_buffer, sizeof(prev_lcd_buffer));
+}
+
+/**
+ * @brief Extend the dirty column ranges of the lines covered by len cells written from first (wrapping to the first line).
+ */
+static void mark_lcd_buf_dirty(const lcd_pos_t *first, uint16_t len)
+{
+    uint16_t index = (uint16_t)(first - &lcd_buffer[LINE_1][C1]);
+
+    if (len > LCD_BUF_SIZE)
     {
-        for (uint8_t x = 0; x < LCD_X; x++)
+        len = LCD_BUF_SIZE;
+    }
+    while (len != 0)
+    {
+        uint8_t line = (uint8_t)(index / LCD_X);
+        uint8_t column = (uint8_t)(index % LCD_X);
+        uint8_t chars = (len < (uint16_t)(LCD_X - column)) ? (uint8_t)len : (uint8_t)(LCD_X - column);
+
+        if (column < lcd_dirty_begin[line])
+        {
+            lcd_dirty_begin[line] = column;
+        }
+        if ((column + chars) > lcd_dirty_end[line])
         {
-            prev_lcd_buffer[y][x] = lcd_buffer[y][x];
+            lcd_dirty_end[line] = column + chars;
         }
+        len -= chars;
+        index = (uint16_t)((index + chars) % LCD_BUF_SIZE);
+    }
+    LCD_BUFFER_UPDATE_FLAG = true;
+}
+
+static void clear_lcd_dirty_lines(void)
+{
+    for (uint8_t y = 0; y < LCD_Y; y++)
+    {
+        lcd_dirty_begin[y] = LCD_X;
+        lcd_dirty_end[y] = 0;
+    }
+    LCD_BUFFER_UPDATE_FLAG = false;
+}
+
+static void start_lcd_flush(void)
+{
+    // changes made to lcd_buffer from now on mark the lines again and are written by the next pass
+    memcpy(lcd_flush_begin, lcd_dirty_begin, sizeof(lcd_flush_begin));
+    memcpy(lcd_flush_end, lcd_dirty_end, sizeof(lcd_flush_end));
+    clear_lcd_dirty_lines();
+    seek_lcd_flush_line(LINE_1);
+}
+
+/**
+ * @brief Move the flush pass to the first cell of the first line from line on that has cells to compare.
+ */
+static void seek_lcd_flush_line(uint8_t line)
+{
+    while ((line < LCD_Y) && (lcd_flush_begin[line] >= lcd_flush_end[line]))
+    {
+        line++;
+    }
+    lcd_flush_line = line;
+    lcd_flush_in_progress = (line < LCD_Y);
+    if (lcd_flush_in_progress == true)
+    {
+        lcd_flush_column = lcd_flush_begin[line];
     }
 }
-static void update_lcd_curosr_possition(uint8_t *lcd_cursor_position, uint8_t *lcd_line, uint8_t *missed_char_counter_in_LCD_line)
+
+/**
+ * @brief Find the first changed cell of the line from column on, comparing a word of cells at a time.
+ * @return column of the changed cell or end when all cells up to end are unchanged.
+ */
+static uint8_t skip_unchanged_lcd_cells(uint8_t line, uint8_t column, uint8_t end)
 {
-    (*lcd_cursor_position)++;
-    if ((*lcd_cursor_position) >= LCD_X)
+    lcd_word_t cells;
+    lcd_word_t prev_cells;
+    bool equal = true;
+
+    while (((column + sizeof(lcd_word_t)) <= end) && (equal == true))
     {
-        *lcd_cursor_position = 0;
-        (*lcd_line)++;
-        *missed_char_counter_in_LCD_line = 0;
-        if (*lcd_line == LCD_Y)
+        memcpy(&cells, &lcd_buffer[line][column], sizeof(cells));
+        memcpy(&prev_cells, &prev_lcd_buffer[line][column], sizeof(prev_cells));
+        equal = (cells == prev_cells);
+        if (equal == true)
         {
-            *lcd_line = LINE_1;
+            column += sizeof(lcd_word_t);
         }
-        lcd_locate(*lcd_line, *lcd_cursor_position);
     }
+    while ((column < end) && (lcd_buffer[line][column] == prev_lcd_buffer[line][column]))
+    {
+        column++;
+    }
+    return column;
 }
 
-static void write_lcd_buf_2_lcd(const uint8_t *lcd_cursor_position, const uint8_t *lcd_line, uint8_t *missed_char_counter_in_LCD_line, const lcd_pos_t *prev_lcd_buff_pos_ptr)
+/**
+ * @brief Number of cells between the LCD cursor and the cell on the same line.
+ * @return 0 if the LCD cursor is on the cell, LCD_ADDRESS_UNKNOWN if the cursor has to be relocated to reach it.
+ */
+static uint8_t get_lcd_flush_gap(uint8_t line, uint8_t column)
 {
-    if ((*lcd_buf_position_ptr) != (*prev_lcd_buff_pos_ptr))
+    uint8_t gap = LCD_ADDRESS_UNKNOWN;
+
+    if ((lcd_address_counter >= lcd_line_address[line]) && (lcd_address_counter <= (lcd_line_address[line] + column)))
     {
-        if (*missed_char_counter_in_LCD_line != 0)
+        gap = (uint8_t)((lcd_line_address[line] + column) - lcd_address_counter);
+    }
+    return gap;
+}
+
+/**
+ * @brief Write the next changed cell of the flush pass to the LCD.
+ * Unchanged cells between the LCD cursor and the changed cell are rewritten when it costs less bus time than a
+ * cursor relocation (LCD_FLUSH_MAX_REWRITTEN_GAP), each rewritten cell takes one transfer from the budget.
+ * @param budget number of bus transfers (commands and characters) that can still be written, decreased by the transfers used.
+ * @return true if the cell was written or no changed cell is left on the line, false if the budget is too small to write it
+ * (the cell is left for the next call).
+ */
+static bool flush_lcd_buf_cell(uint8_t *budget)
+{
+    uint8_t line = lcd_flush_line;
+    uint8_t column = skip_unchanged_lcd_cells(line, lcd_flush_column, lcd_flush_end[line]);
+    bool handled = true;
+
+    lcd_flush_column = column;
+    if (column < lcd_flush_end[line])
+    {
+        uint8_t gap = get_lcd_flush_gap(line, column);
+        bool rewrite_gap = (gap <= LCD_FLUSH_MAX_REWRITTEN_GAP) && (gap < *budget);
+        uint8_t needed = rewrite_gap ? (gap + 1U) : LCD_FLUSH_MIN_BUDGET;
+
+        handled = (needed <= *budget);
+        if (handled == true)
         {
-            lcd_locate(*lcd_line, *lcd_cursor_position);
-            *missed_char_counter_in_LCD_line = 0;
+            if (rewrite_gap == true)
+            {
+                rewrite_lcd_buf_cells(line, column - gap, column);
+            }
+            else
+            {
+                lcd_locate(line, column);
+            }
+            lcd_char(lcd_buffer[line][column]);
+            prev_lcd_buffer[line][column] = lcd_buffer[line][column];
+            *budget -= needed;
+            lcd_flush_column++;
         }
-        lcd_char(*lcd_buf_position_ptr);
     }
-    else
+    if (lcd_flush_column >= lcd_flush_end[line])
+    {
+        seek_lcd_flush_line(line + 1U);
+    }
+    return handled;
+}
+
+/**
+ * @brief Write the cells of the line from column up to end to the LCD at the current LCD cursor position.
+ */
+static void rewrite_lcd_buf_cells(uint8_t line, uint8_t column, uint8_t end)
+{
+    for (; column < end; column++)
+    {
+        lcd_char(lcd_buffer[line][column]);
+        prev_lcd_buffer[line][column] = lcd_buffer[line][column];
+    }
+}
+
+/**
+ * @brief Follow the DDRAM address counter of the LCD through a command.
+ */
+static void track_lcd_address_counter(uint8_t cmd)
+{
+    // the instruction is selected by the highest set bit of the command
+    if (cmd >= LCDC_SET_DDRAM)
     {
-        (*missed_char_counter_in_LCD_line)++;
+        lcd_address_counter = cmd & LCD_DDRAM_ADDRESS_MASK;
+    }
+    else if ((cmd >= LCDC_SET_CGRAM) || ((cmd >= LCDC_SHIFT) && (cmd < LCDC_FUNC)) || ((cmd >= LCDC_ENTRY_MODE) && (cmd < LCDC_ONOFF)))
+    {
+        // CGRAM access, cursor shift and entry mode changes are not followed
+        lcd_address_counter = LCD_ADDRESS_UNKNOWN;
+    }
+    else if (cmd < LCDC_ENTRY_MODE)
+    {
+        // clear display and return home
+        lcd_address_counter = 0;
     }
 }
 
@@ -281,46 +686,214 @@ char lcd_translate_char(char c)
 
 #endif
 
-void lcd_init(void)
+/**************************BASIC LCD INIT - basing on DS init procedure***************************************/
+static void lcd_init_power_up(void)
 {
     register_LCD_IO_driver();
     LCD->init_LCD_pins();
     lcd_disable_backlight();
-    /**************************BASIC LCD INIT - basing on DS init procedure***************************************/
+#if LCD_ADAPTIVE_TIMING == ON
+    lcd_exec_us = 0U;
+#endif
     // set all LCD signals to High for more than 15ms ->bit different than in DS based on other implementations from the internet
     lcd_set_all_SIG();
-    LCD->delay_us(15000);
+}
+
+static void lcd_init_first_wake_up(void)
+{
     lcd_reset_all_SIG();
     // send 0x03 & wait more then 4,1ms
     lcd_write_4bit_data(0x03);
-    LCD->delay_us(4500);
-    // send 0x03 & wait more then 100us
-    lcd_write_4bit_data(0x03);
-    LCD->delay_us(110);
+}
+
+static void lcd_init_wake_up(void)
+{
     // send 0x03 & wait more then 100us
     lcd_write_4bit_data(0x03);
-    LCD->delay_us(110);
+}
+
+static void lcd_init_set_4bit_mode(void)
+{
     // send 0x02 & wait more then 100us
     lcd_write_4bit_data(0x02);
-    LCD->delay_us(110);
+}
+
+static void lcd_init_function_set(void)
+{
     // FUNCTION SET ->send cmd -> LCD in 4-bit mode, 2 rows, char size 5x7
-    lcd_write_cmd(LCDC_FUNC | LCDC_FUNC4B | LCDC_FUNC2L | LCDC_FUNC5x7);
+    lcd_send_cmd(LCDC_FUNC | LCDC_FUNC4B | LCDC_FUNC2L | LCDC_FUNC5x7);
+}
+
+static void lcd_init_display_on(void)
+{
     // DISPLAY_ON_OFF send cmd -> enable lcd
-    lcd_write_cmd(LCDC_ONOFF | LCDC_CURSOROFF | LCDC_DISPLAYON);
+    lcd_send_cmd(LCDC_ONOFF | LCDC_CURSOROFF | LCDC_DISPLAYON);
+}
+
+static void lcd_init_clear(void)
+{
     // LCD clear screen
-    lcd_cls();
+    lcd_send_cmd(LCDC_CLS);
+}
+
+static void lcd_init_entry_mode(void)
+{
     // ENTRY MODe SET do not shift the LCD shift cursor right after placing a char
-    lcd_write_cmd(LCDC_ENTRY_MODE | LCDC_ENTRYR);
-    /*********************************END of BASIC LCD INIT***************************************/
+    lcd_send_cmd(LCDC_ENTRY_MODE | LCDC_ENTRYR);
+}
+
+static const lcd_init_step_t lcd_init_steps[] = {
+    {lcd_init_power_up, 15000U, false},
+    {lcd_init_first_wake_up, 4500U, false},
+    {lcd_init_wake_up, 110U, false},
+    {lcd_init_wake_up, 110U, false},
+    {lcd_init_set_4bit_mode, 110U, false},
+    {lcd_init_function_set, LCD_CMD_EXEC_US, true},
+    {lcd_init_display_on, LCD_CMD_EXEC_US, true},
+    {lcd_init_clear, LCD_CLEAR_HOME_EXEC_US, true},
+    {lcd_init_entry_mode, LCD_CMD_EXEC_US, true},
+};
+/*********************************END of BASIC LCD INIT***************************************/
+
+static void wait_lcd_init_step(const lcd_init_step_t *step)
+{
+#if USE_RW_PIN == ON
+    if (step->busy_flag == true)
+    {
+        lcd_wait_ready();
+    }
+    else
+    {
+        LCD->delay_us(step->wait_us);
+    }
+#else
+    LCD->delay_us(step->wait_us);
+#endif
+}
+
+/**
+ * @brief Send the next step of the non blocking init sequence and note when it was sent.
+ */
+static void run_lcd_init_step(void)
+{
+    lcd_init_steps[lcd_init_next_step].action();
+    lcd_init_step_time_us = lcd_get_time_us();
+    lcd_init_next_step++;
+}
+
+/**
+ * @brief Check if the LCD still executes the last step of the non blocking init sequence.
+ * Command steps end earlier when the busy flag can be read.
+ */
+static bool is_lcd_init_step_pending(const lcd_init_step_t *step)
+{
+    bool pending = ((uint32_t)(lcd_get_time_us() - lcd_init_step_time_us) < step->wait_us);
+
+#if USE_RW_PIN == ON
+    if ((pending == true) && (step->busy_flag == true))
+    {
+        pending = lcd_read_busy_flag();
+    }
+#endif
+    return pending;
+}
+
+/**
+ * @brief Set The LCD buffers to the content of the LCD cleared by the init sequence.
+ */
+static void reset_lcd_buffers(void)
+{
 #if LCD_BUFFERING == ON
     // clear lcd_buffer by putting spaces inside of the buffer
     lcd_buf_cls();
     // copy lcd_buffer with spaces to prev_lcd_buffer
     copy_lcd_buf_2_prev_lcd_buf();
-    // clear flag due to init procedure that reset LCD screen and buffers
-    LCD_BUFFER_UPDATE_FLAG = false;
+    // clear flag and dirty lines due to init procedure that reset LCD screen and buffers
+    clear_lcd_dirty_lines();
+    lcd_flush_in_progress = false;
 #endif
 }
+
+/**
+ * @brief Function that initializes the LCD, blocking until the init sequence is finished (~20 ms).
+ */
+void lcd_init(void)
+{
+    for (uint8_t step = 0U; step < LCD_INIT_STEPS_QTY; step++)
+    {
+        lcd_init_steps[step].action();
+        wait_lcd_init_step(&lcd_init_steps[step]);
+    }
+    lcd_init_next_step = LCD_INIT_STEPS_QTY;
+    reset_lcd_buffers();
+    lcd_ready = true;
+}
+
+/**
+ * @brief Function for setting the monotonic microsecond time source used by lcd_init_start() and lcd_init_poll().
+ * With LCD_ADAPTIVE_TIMING it is also used to skip the wait for a written byte when its worst case execution time
+ * has already elapsed before the next transfer.
+ * @param get_time_us Function returning a free running microsecond counter, wrapping at 2^32 us.
+ */
+void lcd_set_time_source(uint32_t (*get_time_us)(void))
+{
+    lcd_get_time_us = get_time_us;
+}
+
+/**
+ * @brief Function that starts the non blocking LCD init sequence.
+ * The power up wait and the execution times of the init commands elapse between lcd_init_poll() calls, so the rest
+ * of the system can be brought up in the meantime. The LCD buffer can be written right after this call, its content
+ * is written to the LCD by the first lcd_update() or lcd_update_step() calls made after the init sequence.
+ * Other lcd_*() functions that write directly to the LCD can be called once lcd_init_poll() returns true.
+ * @attention Without a time source set by lcd_set_time_source() the init sequence is done by the blocking lcd_init().
+ */
+void lcd_init_start(void)
+{
+    if (lcd_get_time_us == NULL)
+    {
+        lcd_init();
+    }
+    else
+    {
+        lcd_ready = false;
+        lcd_init_next_step = 0U;
+        reset_lcd_buffers();
+        run_lcd_init_step();
+    }
+}
+
+/**
+ * @brief Function that continues the LCD init sequence started by lcd_init_start().
+ * Sends every init step whose wait time has elapsed, it never waits for the LCD. Call it periodically (main loop pass,
+ * timer tick) until it returns true; the init sequence ends as soon as the power up and command execution times
+ * have passed (~20 ms).
+ * @return true when the init sequence is finished and the LCD is ready, false also when it was not started by
+ * lcd_init_start() or the time source was removed before its end.
+ */
+bool lcd_init_poll(void)
+{
+    /* nothing to continue before lcd_init_start() or without a time source */
+    bool waiting = (lcd_init_next_step == 0U) || (lcd_get_time_us == NULL);
+
+    while ((lcd_ready == false) && (waiting == false))
+    {
+        waiting = is_lcd_init_step_pending(&lcd_init_steps[lcd_init_next_step - 1U]);
+        if (waiting == false)
+        {
+            if (lcd_init_next_step < LCD_INIT_STEPS_QTY)
+            {
+                run_lcd_init_step();
+            }
+            else
+            {
+                lcd_ready = true;
+            }
+        }
+    }
+    return lcd_ready;
+}
+
 /**
  * @brief Function for disabling backlight od the LCD
  */
@@ -354,7 +927,7 @@ void lcd_disable_backlight(void)
 void lcd_cls(void)
 {
     lcd_write_cmd(LCDC_CLS);
-#if USE_RW_PIN == OFF
+#if (USE_RW_PIN == OFF) && (LCD_ADAPTIVE_TIMING == OFF)
     LCD->delay_us(4900);
 #endif
 }
@@ -565,7 +1138,7 @@ void lcd_locate(enum LCD_LINES_e y, enum LCD_COLUMNS_e x)
 void lcd_home(void)
 {
     lcd_write_cmd(LCDC_CLS | LCDC_HOME);
-#if USE_RW_PIN == OFF
+#if (USE_RW_PIN == OFF) && (LCD_ADAPTIVE_TIMING == OFF)
     LCD->delay_us(4900);
 #endif
 }
@@ -607,12 +1180,9 @@ void lcd_blinking_cursor_on(void)
  */
 void lcd_buf_cls(void)
 {
-    for (lcd_buf_position_ptr = &lcd_buffer[LINE_1][C1]; lcd_buf_position_ptr <= &lcd_buffer[LAST_LCD_LINE][LAST_CHAR_IN_LCD_LINE]; lcd_buf_position_ptr++)
-    {
-        *lcd_buf_position_ptr = ' ';
-    }
+    memset(lcd_buffer, ' ', sizeof(lcd_buffer));
     lcd_buf_position_ptr = &lcd_buffer[LINE_1][C1];
-    LCD_BUFFER_UPDATE_FLAG = true;
+    mark_lcd_buf_dirty(lcd_buf_position_ptr, LCD_BUF_SIZE);
 }
 
 /**
@@ -624,9 +1194,9 @@ void lcd_buf_cls(void)
 void lcd_buf_char(const char c)
 {
     *lcd_buf_position_ptr = c;
+    mark_lcd_buf_dirty(lcd_buf_position_ptr, 1);
     lcd_buf_position_ptr++;
     check_lcd_buf_possition_ptr_overflow();
-    LCD_BUFFER_UPDATE_FLAG = true;
 }
 
 /**
@@ -645,40 +1215,86 @@ void lcd_buf_locate(enum LCD_LINES_e y, enum LCD_COLUMNS_e x)
  */
 void lcd_buf_str(const char *str)
 {
+    const lcd_pos_t *first = lcd_buf_position_ptr;
+    uint16_t len = 0;
+
     while (*str)
     {
         *(lcd_buf_position_ptr++) = *(str++);
         check_lcd_buf_possition_ptr_overflow();
+        len++;
     }
-    LCD_BUFFER_UPDATE_FLAG = true;
+    mark_lcd_buf_dirty(first, len);
+}
+
+#ifdef AVR
+/**
+ * @brief Function for placing the string stored in program memory in the LCD buffer starts from the current LCD buffer position pointer.
+ * @param str string located in program memory (PROGMEM) that should be placed in the LCD buffer
+ */
+void lcd_buf_str_P(const char *str)
+{
+    const lcd_pos_t *first = lcd_buf_position_ptr;
+    uint16_t len = 0;
+    char c = (char)pgm_read_byte(str);
+
+    while (c)
+    {
+        *(lcd_buf_position_ptr++) = c;
+        check_lcd_buf_possition_ptr_overflow();
+        len++;
+        c = (char)pgm_read_byte(++str);
+    }
+    mark_lcd_buf_dirty(first, len);
 }
+#endif
 
 /**
  * @brief Function that prints on the LCD screen the content of The LCD buffer.
  * The function sets also The LCD buffer position pointer to the First line's first character.
+ * @note The whole change is written in one call. Use lcd_update_step() to keep the time spent in one call bounded.
+ * Nothing is written before the end of the init sequence started by lcd_init_start().
  */
 void lcd_update(void)
 {
-    if (LCD_BUFFER_UPDATE_FLAG == true)
+    if ((lcd_ready == true) && ((LCD_BUFFER_UPDATE_FLAG == true) || (lcd_flush_in_progress == true)))
     {
-        uint8_t lcd_cursor_position = 0;
-        uint8_t lcd_line = 0;
-        uint8_t missed_char_counter_in_LCD_line = 0;
-        const lcd_pos_t *prev_lcd_buff_pos_ptr = &prev_lcd_buffer[LINE_1][C1];
-
-        for (lcd_buf_position_ptr = &lcd_buffer[LINE_1][C1]; lcd_buf_position_ptr <= &lcd_buffer[LAST_LCD_LINE][LAST_CHAR_IN_LCD_LINE]; lcd_buf_position_ptr++)
+        while (lcd_update_step(UINT8_MAX) == false)
         {
-            write_lcd_buf_2_lcd(&lcd_cursor_position, &lcd_line, &missed_char_counter_in_LCD_line, prev_lcd_buff_pos_ptr);
-            update_lcd_curosr_possition(&lcd_cursor_position, &lcd_line, &missed_char_counter_in_LCD_line);
-            prev_lcd_buff_pos_ptr++;
         }
-
         lcd_buf_position_ptr = &lcd_buffer[LINE_1][C1];
-        copy_lcd_buf_2_prev_lcd_buf();
-        LCD_BUFFER_UPDATE_FLAG = false;
     }
 }
 
+/**
+ * @brief Function that prints on the LCD screen a part of the changes in The LCD buffer.
+ * Each call writes at most budget bus transfers (cursor relocations and characters) and the next call resumes from the
+ * saved position, so it can be called on every main loop pass or from a timer tick. Changes made in The LCD buffer
+ * during a flush are written by the current pass when they are ahead of the saved position, otherwise by the next pass.
+ * @param budget Maximum number of commands and characters written to the LCD by this call. Values lower than 2
+ * (cursor relocation + one character) are raised to 2.
+ * @return true if the LCD screen shows the content of The LCD buffer, false if there are changes left to write or the
+ * init sequence started by lcd_init_start() is not finished yet (nothing is written then).
+ */
+bool lcd_update_step(uint8_t budget)
+{
+    bool cell_handled = (lcd_ready == true); /* nothing is written before the end of the init sequence */
+
+    if (budget < LCD_FLUSH_MIN_BUDGET)
+    {
+        budget = LCD_FLUSH_MIN_BUDGET;
+    }
+    if ((cell_handled == true) && (lcd_flush_in_progress == false) && (LCD_BUFFER_UPDATE_FLAG == true))
+    {
+        start_lcd_flush();
+    }
+    while ((lcd_flush_in_progress == true) && (cell_handled == true))
+    {
+        cell_handled = flush_lcd_buf_cell(&budget);
+    }
+    return (lcd_ready == true) && (lcd_flush_in_progress == false) && (LCD_BUFFER_UPDATE_FLAG == false);
+}
+
 #if USE_LCD_BUF_INT == ON
 /**
  * @brief Function for adding integer value as string to the LCD buffer under the current position of the LCD buffer pointer.
@@ -71,6 +71,9 @@ extern "C"
     };
 
     void lcd_init(void);
+    void lcd_set_time_source(uint32_t (*get_time_us)(void));
+    void lcd_init_start(void);
+    bool lcd_init_poll(void);
     void lcd_enable_backlight(void);
     void lcd_disable_backlight(void);
     void lcd_cls(void);
@@ -95,7 +98,11 @@ extern "C"
     void lcd_buf_char(const char c);
     void lcd_buf_locate(enum LCD_LINES_e y, enum LCD_COLUMNS_e x);
     void lcd_buf_str(const char *str);
+#ifdef AVR
+    void lcd_buf_str_P(const char *str);
+#endif
     void lcd_update(void);
+    bool lcd_update_step(uint8_t budget);
 
     void lcd_buf_int(int val, uint8_t width, enum LCD_alignment_e alignment);
     void lcd_buf_hex(int val, uint8_t width, enum LCD_alignment_e alignment);
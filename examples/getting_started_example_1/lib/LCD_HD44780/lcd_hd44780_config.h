@@ -23,6 +23,8 @@ extern "C"
 #define OFF     0
 #define HIGH    1
 #define LOW     0
+#define LCD_TRANSPORT_GPIO  0
+#define LCD_TRANSPORT_I2C   1
 
 /************************************  LCD HARDWARE SETTINGS *******************************
 *   LCD_TYPE -> Set one of the predefined types:
@@ -38,6 +40,14 @@ extern "C"
 *   LCD_BUFFERING -> Defines whether you would like to use LCD buffer or only use functions to print directly on LCD screen
 *               ON - when buffering of LCD is planned to be used in the project
 *               OFF - when buffering of LCD is NOT planned to be used in the project
+*   LCD_TRANSPORT -> Defines how LCD_IO_driver_interface_struct reaches the LCD pins (cost model used by lcd_update())
+*               LCD_TRANSPORT_GPIO - LCD pins connected directly to uC GPIO
+*               LCD_TRANSPORT_I2C - LCD pins driven by an I2C port expander backpack (each pin change is one I2C write)
+*   LCD_ADAPTIVE_TIMING -> Defines how the driver waits for the execution of a byte written to the LCD
+*               ON - worst case execution time of the written instruction; with a time source set by
+*                    lcd_set_time_source() the wait is done before the next byte and skipped (no busy flag polling,
+*                    no delay) when the execution time has already elapsed
+*               OFF - busy flag polled after every byte (USE_RW_PIN ON) or a fixed 120 us delay per byte
 ********************************************************************************************/
 
 #define LCD_TYPE                2004   // init
@@ -47,6 +57,10 @@ extern "C"
 
 #define LCD_BUFFERING           ON      // compilation
 
+#define LCD_TRANSPORT           LCD_TRANSPORT_GPIO  // compilation
+
+#define LCD_ADAPTIVE_TIMING     ON      // compilation
+
 /********************************  LCD LIBRARY COMPILATION SETTINGS ************************
  *      Setting USE_(procedure name) to:
  *          ON  - add specific procedure to compilation
@@ -7,6 +7,11 @@
 #include "menu.h"
 #include "menu_handlers.h"
 #include <stddef.h>
+#ifdef MENU_USE_FLASH_STRINGS
+#include <avr/pgmspace.h>
+#else
+#define PROGMEM
+#endif
 
 static void info_cb(void);
 static void lcd_brightness_cb(void);
@@ -15,14 +20,23 @@ static void start_cb(void);
 static void stop_cb(void);
 static void about_cb(void);
 
-menu_t menu_1 = {"Info", &menu_2, NULL, NULL, NULL, info_cb};
-menu_t menu_2 = {"Settings", &menu_3, &menu_1, &menu_2_1, NULL, NULL};
-menu_t menu_2_1 = {"LCD Brightness", &menu_2_2, NULL, NULL, &menu_2, lcd_brightness_cb};
-menu_t menu_2_2 = {"Sound", NULL, &menu_2_1, NULL, &menu_2, sound_cb};
-menu_t menu_3 = {"Action", &menu_4, &menu_2, &menu_3_1, NULL, NULL};
-menu_t menu_3_1 = {"Start", &menu_3_2, NULL, NULL, &menu_3, start_cb};
-menu_t menu_3_2 = {"Stop", NULL, &menu_3_1, NULL, &menu_3, stop_cb};
-menu_t menu_4 = {"About", NULL, &menu_3, NULL, NULL, about_cb};
+static const char menu_1_name[] PROGMEM = "Info";
+static const char menu_2_name[] PROGMEM = "Settings";
+static const char menu_2_1_name[] PROGMEM = "LCD Brightness";
+static const char menu_2_2_name[] PROGMEM = "Sound";
+static const char menu_3_name[] PROGMEM = "Action";
+static const char menu_3_1_name[] PROGMEM = "Start";
+static const char menu_3_2_name[] PROGMEM = "Stop";
+static const char menu_4_name[] PROGMEM = "About";
+
+const menu_t menu_1 = {menu_1_name, &menu_2, NULL, NULL, NULL, info_cb};
+const menu_t menu_2 = {menu_2_name, &menu_3, &menu_1, &menu_2_1, NULL, NULL};
+const menu_t menu_2_1 = {menu_2_1_name, &menu_2_2, NULL, NULL, &menu_2, lcd_brightness_cb};
+const menu_t menu_2_2 = {menu_2_2_name, NULL, &menu_2_1, NULL, &menu_2, sound_cb};
+const menu_t menu_3 = {menu_3_name, &menu_4, &menu_2, &menu_3_1, NULL, NULL};
+const menu_t menu_3_1 = {menu_3_1_name, &menu_3_2, NULL, NULL, &menu_3, start_cb};
+const menu_t menu_3_2 = {menu_3_2_name, NULL, &menu_3_1, NULL, &menu_3, stop_cb};
+const menu_t menu_4 = {menu_4_name, NULL, &menu_3, NULL, NULL, about_cb};
 
 static void info_cb(void)
 {
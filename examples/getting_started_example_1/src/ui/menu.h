@@ -11,18 +11,22 @@
 extern "C" {
 #endif
 
+#ifdef AVR
+#define MENU_USE_FLASH_STRINGS /* keep menu names in program memory, SRAM of the ATmega328P is 2 KB */
+#endif
+
 #include "menu_lib_type.h"
 
 #define MAX_MENU_DEPTH 2
 
-extern menu_t menu_1;
-extern menu_t menu_2;
-  extern menu_t menu_2_1;
-  extern menu_t menu_2_2;
-extern menu_t menu_3;
-  extern menu_t menu_3_1;
-  extern menu_t menu_3_2;
-extern menu_t menu_4;
+extern const menu_t menu_1;
+extern const menu_t menu_2;
+  extern const menu_t menu_2_1;
+  extern const menu_t menu_2_2;
+extern const menu_t menu_3;
+  extern const menu_t menu_3_1;
+  extern const menu_t menu_3_2;
+extern const menu_t menu_4;
 
 #ifdef __cplusplus
 }
@@ -22,6 +22,10 @@ static uint8_t brightness = 5; // demo state 0..20
 static void on_menu_enter(void);
 static void on_menu_exit(void);
 static void keypad_bind_menu_controls(void);
+static void post_menu_prev(void);
+static void post_menu_next(void);
+static void post_menu_enter(void);
+static void post_menu_esc(void);
 
 /** menu info static section handlers */
 static void info_exit_cb(void);
@@ -95,7 +99,25 @@ static void on_menu_exit(void)
 
 static void keypad_bind_menu_controls(void)
 {
-    keypad_bind_conrtol_handlers(menu_prev, menu_next, menu_enter, menu_esc);
+    // Keys only queue navigation events; ui_update() applies them with menu_process()
+    keypad_bind_conrtol_handlers(post_menu_prev, post_menu_next, post_menu_enter, post_menu_esc);
+}
+
+static void post_menu_prev(void)
+{
+    (void)menu_post_event(MENU_EVENT_PREV);
+}
+static void post_menu_next(void)
+{
+    (void)menu_post_event(MENU_EVENT_NEXT);
+}
+static void post_menu_enter(void)
+{
+    (void)menu_post_event(MENU_EVENT_ENTER);
+}
+static void post_menu_esc(void)
+{
+    (void)menu_post_event(MENU_EVENT_ESC);
 }
 
 /** menu info static section handlers */
@@ -24,7 +24,10 @@ const struct menu_screen_driver_interface_struct display_driver = {
     .print_string = lcd_buf_str,
     .print_char = lcd_buf_char,
     .get_number_of_screen_lines = get_screen_lines,
-    .get_number_of_chars_per_line = get_screen_columns
+    .get_number_of_chars_per_line = get_screen_columns,
+#ifdef AVR
+    .print_flash_string = lcd_buf_str_P,
+#endif
 };
 
 // --- Callback definitions ---
@@ -15,6 +15,10 @@
 
 // #include <stddef.h>
 
+// Commands and characters written to the LCD in one ui_update() pass (about 0.45 ms with LCD_ADAPTIVE_TIMING,
+// 53/59 us per command/character byte; a clear or home command takes 2160 us)
+#define LCD_UPDATE_STEP_BUDGET 8U
+
 void ui_init(void)
 {
     // Initialize MENU_LIB (fetches display interface and validates it and initialize the lcd)
@@ -32,11 +36,14 @@ void ui_init(void)
 
 void ui_update(void)
 {
-    // Process debounced buttons; drives MENU_LIB when in menu mode
+    // Process debounced buttons; posts MENU_LIB navigation events when in menu mode
     keypad_process();
 
-    // Keep the display refreshed when buffering is enabled
-    lcd_update();
+    // Apply queued navigation events, the menu view is redrawn once per call
+    menu_process();
+
+    // Keep the display refreshed when buffering is enabled, a big change is written over several passes
+    (void)lcd_update_step(LCD_UPDATE_STEP_BUDGET);
 } 
 
 
@@ -8,6 +8,29 @@
  * Provides menu initialization, navigation, and rendering logic for embedded systems.
  * Includes validation of menu depth, screen drawing, and safe handling of pointers.
  *
+ * All engine state lives in a menu_ctx_t instance. The context-free API
+ * (menu_init(), menu_next(), ...) operates on a default context.
+ *
+ * With MENU_USE_SHADOW_BUFFER defined, composed rows are compared with a copy
+ * of the characters already sent to the display and only changed spans are written.
+ *
+ * With MENU_USE_STATIC_DRIVER defined, cursor_position, print_string,
+ * print_char, write_row and fill are direct calls bound in
+ * MENU_STATIC_DRIVER_HEADER instead of calls through the driver interface.
+ *
+ * With MENU_USE_SLIM_NODES defined, menu_t items have no prev and parent
+ * links. The engine keeps the items selected on the levels above the current
+ * one in menu_ctx_t::menu_path and walks forward from the window top (or the
+ * first item of the level) to find the previous item.
+ *
+ * With MENU_USE_FLASH_STRINGS defined, item names and headers are read with
+ * MENU_FLASH_READ_CHAR() and printed with print_flash_string (or character by
+ * character), so they can stay in the program memory of Harvard MCUs.
+ *
+ * With MENU_USE_TRACE defined, navigation functions, view updates and display
+ * driver calls write binary records into a static ring (see menu_trace_dump()).
+ * Without it the MENU_TRACE_* hooks expand to nothing.
+ *
  * @copyright Copyright (c) 2025
  *
  * @ingroup MenuLib
@@ -35,41 +58,241 @@
 #define MENU_VIEW_FIRST_ROW 1U        /**< First row used for displaying menu items */
 #define FIRST_COLUMN 0U               /**< Index of the first display column */
 #define HEADER_ROW_OFFSET 1U          /**< Offset between header and menu view */
+#define EVENT_QUEUE_INDEX_MASK ((uint8_t)(MENU_EVENT_QUEUE_SIZE - 1U)) /**< Event ring slot mask */
 
-/* --- Internal state --- */
-PRIVATE bool menu_initialized = false; /**< Indicates if menu system has been initialized */
+/* --- Trace hooks --- */
+#ifdef MENU_USE_TRACE
+#define TRACE_INDEX_MASK ((uint16_t)(MENU_TRACE_BUFFER_SIZE - 1U)) /**< Trace ring slot mask */
+#define TRACE_DUMP_VERSION 1U                                      /**< menu_trace_dump() format version */
+#define TRACE_DUMP_RECORD_SIZE 8U                                  /**< Serialized record size */
+/** @brief Record function entry with the current level and selection index. */
+#define MENU_TRACE_BEGIN(ctx, event) \
+    menu_trace_record((uint8_t)(event), (ctx)->menu_level, (ctx)->cursor_selection_menu_index[(ctx)->menu_level])
+/** @brief Record function exit with the current level and selection index. */
+#define MENU_TRACE_END(ctx, event) \
+    menu_trace_record((uint8_t)((event) | MENU_TRACE_END_FLAG), (ctx)->menu_level, (ctx)->cursor_selection_menu_index[(ctx)->menu_level])
+/** @brief Record a display driver call. */
+#define MENU_TRACE_DRIVER(event, row, column) menu_trace_record((uint8_t)(event), (uint8_t)(row), (uint16_t)(column))
+#else
+#define MENU_TRACE_BEGIN(ctx, event) ((void)0)
+#define MENU_TRACE_END(ctx, event) ((void)0)
+#define MENU_TRACE_DRIVER(event, row, column) ((void)0)
+#endif
+
+/* --- Display driver access --- */
+#ifdef MENU_USE_STATIC_DRIVER
+#ifndef MENU_STATIC_DRIVER_HEADER
+#define MENU_STATIC_DRIVER_HEADER "menu_static_driver.h" /**< Header binding the driver calls at compile time */
+#endif
+#include MENU_STATIC_DRIVER_HEADER
+#if !defined(MENU_STATIC_DRV_CURSOR_POSITION) || !defined(MENU_STATIC_DRV_PRINT_STRING) || !defined(MENU_STATIC_DRV_PRINT_CHAR)
+#error "MENU_STATIC_DRIVER_HEADER must define MENU_STATIC_DRV_CURSOR_POSITION, MENU_STATIC_DRV_PRINT_STRING and MENU_STATIC_DRV_PRINT_CHAR"
+#endif
+#define DRV_CURSOR_POSITION(ctx, row, column) ((void)(ctx), MENU_STATIC_DRV_CURSOR_POSITION((row), (column)))
+#define DRV_PRINT_STRING(ctx, str) ((void)(ctx), MENU_STATIC_DRV_PRINT_STRING(str))
+#define DRV_PRINT_CHAR(ctx, c) ((void)(ctx), MENU_STATIC_DRV_PRINT_CHAR(c))
+#ifdef MENU_STATIC_DRV_WRITE_ROW
+#define DRV_HAS_WRITE_ROW(ctx) ((void)(ctx), true)
+#define DRV_WRITE_ROW(ctx, row, buf, len) ((void)(ctx), MENU_STATIC_DRV_WRITE_ROW((row), (buf), (len)))
+#else
+#define DRV_HAS_WRITE_ROW(ctx) ((void)(ctx), false)
+#define DRV_WRITE_ROW(ctx, row, buf, len) ((void)(ctx), (void)(row), (void)(buf), (void)(len))
+#endif
+#ifdef MENU_STATIC_DRV_FILL
+#define DRV_HAS_FILL(ctx) ((void)(ctx), true)
+#define DRV_FILL(ctx, row, column, c, len) ((void)(ctx), MENU_STATIC_DRV_FILL((row), (column), (c), (len)))
+#else
+#define DRV_HAS_FILL(ctx) ((void)(ctx), false)
+#define DRV_FILL(ctx, row, column, c, len) ((void)(ctx), (void)(row), (void)(column), (void)(c), (void)(len))
+#endif
+#ifdef MENU_STATIC_DRV_PRINT_FLASH_STRING
+#define DRV_HAS_PRINT_FLASH_STRING(ctx) ((void)(ctx), true)
+#define DRV_PRINT_FLASH_STRING(ctx, str) ((void)(ctx), MENU_STATIC_DRV_PRINT_FLASH_STRING(str))
+#else
+#define DRV_HAS_PRINT_FLASH_STRING(ctx) ((void)(ctx), false)
+#define DRV_PRINT_FLASH_STRING(ctx, str) ((void)(ctx), (void)(str))
+#endif
+#else
+#define DRV_CURSOR_POSITION(ctx, row, column) (ctx)->display->cursor_position((row), (column))
+#define DRV_PRINT_STRING(ctx, str) (ctx)->display->print_string(str)
+#define DRV_PRINT_CHAR(ctx, c) (ctx)->display->print_char(c)
+#define DRV_HAS_WRITE_ROW(ctx) ((ctx)->display->write_row != NULL)
+#define DRV_WRITE_ROW(ctx, row, buf, len) (ctx)->display->write_row((row), (buf), (len))
+#define DRV_HAS_FILL(ctx) ((ctx)->display->fill != NULL)
+#define DRV_FILL(ctx, row, column, c, len) (ctx)->display->fill((row), (column), (c), (len))
+#define DRV_HAS_PRINT_FLASH_STRING(ctx) ((ctx)->display->print_flash_string != NULL)
+#define DRV_PRINT_FLASH_STRING(ctx, str) (ctx)->display->print_flash_string(str)
+#endif
+
+/* --- Menu string access --- */
+#ifdef MENU_USE_FLASH_STRINGS
+#ifdef MENU_FLASH_ACCESS_HEADER
+#include MENU_FLASH_ACCESS_HEADER
+#elif defined(__AVR__)
+#include <avr/pgmspace.h>
+#endif
+#ifndef MENU_FLASH_READ_CHAR
+#ifdef __AVR__
+#define MENU_FLASH_READ_CHAR(ptr) ((char)pgm_read_byte(ptr)) /**< Read one character of a program memory string */
+#else
+#define MENU_FLASH_READ_CHAR(ptr) (*(ptr)) /**< Program memory is in the data address space */
+#endif
+#endif
+#ifndef MENU_FLASH_ATTR
+#ifdef __AVR__
+#define MENU_FLASH_ATTR PROGMEM /**< Places the engine strings in program memory */
+#else
+#define MENU_FLASH_ATTR
+#endif
+#endif
+#define MENU_TEXT_CHAR(ptr) MENU_FLASH_READ_CHAR(ptr) /**< Read one character of a name or header */
+#else
+#define MENU_TEXT_CHAR(ptr) (*(ptr))
+#define MENU_FLASH_ATTR
+#endif
+
+/* --- Menu item access --- */
+#ifdef MENU_USE_COMPACT_TABLE
+typedef const menu_table_t *menu_source_t;    /**< Storage the menu items are read from */
+#define MENU_SOURCE(ctx) ((ctx)->menu_table)  /**< Item storage of a context */
+#define MENU_ROOT_SOURCE(root) (root)         /**< Item storage of a menu root */
+#define MENU_ROOT_ITEM(root) (MENU_ROOT_NODE) /**< First top level item of a menu root */
+#else
+typedef const void *menu_source_t; /**< Unused, items are linked by pointers */
+#define MENU_SOURCE(ctx) NULL
+#define MENU_ROOT_SOURCE(root) NULL
+#define MENU_ROOT_ITEM(root) (root)
+#endif
+
+/* --- Internal types --- */
+/**
+ * @brief Application code left to run by a navigation step.
+ */
+typedef struct
+{
+    menu_callback_t callback; /**< Item callback or top-level exit callback */
+#ifdef MENU_USE_VIRTUAL_LISTS
+    void (*list_select)(uint16_t index); /**< on_select() of the entered virtual list entry */
+    uint16_t list_index;                 /**< Index of the entered virtual list entry */
+#endif
+} menu_action_t;
 
-PRIVATE uint8_t menu_number_of_chars_per_line;
-PRIVATE uint8_t menu_number_of_screen_lines;
+/**
+ * @brief Source of the names printed in the rows of the menu view.
+ */
+typedef struct
+{
+    menu_ref_t item; /**< Next regular item, MENU_NO_NODE past the last one */
+#ifdef MENU_USE_VIRTUAL_LISTS
+    uint16_t list_index;                    /**< Next virtual list entry */
+    uint16_t list_count;                    /**< Number of virtual list entries (0 on regular levels) */
+    char name_buf[MENU_MAX_CHARS_PER_LINE]; /**< Name of the last fetched virtual list entry */
+#endif
+} menu_view_iter_t;
 
-static menu_t *current_menu_pointer;
-static menu_t *menu_item_2_print = NULL;
-static menu_t *menu_1st_item = NULL;
+/**
+ * @brief State of the iterative menu tree validation.
+ */
+typedef struct
+{
+    menu_source_t src;               /**< Storage the menu items are read from */
+    menu_ref_t path[MAX_MENU_DEPTH]; /**< Visited item on every level down to the current one */
+    uint8_t level;                   /**< Level of the visited item */
+    bool finished;                   /**< Set when the last top level item was left */
+#ifdef MENU_USE_SLIM_NODES
+    uint16_t items_qty[MAX_MENU_DEPTH]; /**< Items visited on every level of the path, bounds next link cycles */
+#endif
+} menu_tree_walk_t;
 
-static uint8_t cursor_selection_menu_index[MAX_MENU_DEPTH];
-static uint8_t cursor_row_position[MAX_MENU_DEPTH];
-static uint8_t menu_level;
+/* --- Internal state --- */
+PRIVATE menu_ctx_t menu_default_ctx; /**< Context used by the context-free API */
 
-PRIVATE const struct menu_screen_driver_interface_struct *DISPLAY = NULL;
-static menu_exit_cb_t menu_top_level_exit_cb = NULL;
+static const char default_header[] MENU_FLASH_ATTR = " MENU ";
+static const char no_name_text[] MENU_FLASH_ATTR = "NO NAME";
 
-static const char *default_header = " MENU ";
-static const char *custom_header = NULL;
+#ifdef MENU_USE_TRACE
+static menu_trace_record_t menu_trace_ring[MENU_TRACE_BUFFER_SIZE]; /**< Trace records, overwritten oldest first */
+static uint16_t menu_trace_head;                                    /**< Free running write index */
+static uint16_t menu_trace_count;                                   /**< Number of valid records */
+static menu_trace_tick_func_ptr menu_trace_tick;                    /**< Timestamp source */
+#endif
 
 /* --- Private function declarations --- */
+static menu_status_t attach_display_interface(menu_ctx_t *ctx, const struct menu_screen_driver_interface_struct *display);
 static bool validate_display_interface(const struct menu_screen_driver_interface_struct *disp);
-static uint8_t compute_menu_depth(const menu_t *menu);
-static menu_status_t validate_menu_view(const menu_t *root_menu);
-static void initialize_menu_view_state(menu_t *root_menu, menu_exit_cb_t menu_exit_cb, const char *custom_menu_header);
-static void display_menu_header(void);
-static void display_main_menu_header(void);
-static void display_sub_menu_header(void);
-static void fill_header_with_dashes(void);
-static void clear_current_menu_view_with_cursor(void);
-static void update_menu_item_pointer_to_print(void);
-static void update_current_menu_view_with_cursor(void);
-static void display_cursor_marker_if_needed(uint8_t row);
-static void display_menu_item_name(uint8_t row, const char *name);
+static bool step_by(menu_ctx_t *ctx, int32_t delta);
+static bool walk_items_by(menu_ctx_t *ctx, int32_t delta);
+static bool step_next_item(menu_ctx_t *ctx);
+static bool step_prev_item(menu_ctx_t *ctx);
+static menu_ref_t get_prev_item(const menu_ctx_t *ctx);
+static menu_ref_t get_parent_item(const menu_ctx_t *ctx);
+static uint8_t get_menu_view_rows(const menu_ctx_t *ctx);
+static bool step_enter(menu_ctx_t *ctx, menu_action_t *action);
+static bool step_enter_item(menu_ctx_t *ctx, menu_action_t *action);
+static bool step_esc(menu_ctx_t *ctx, menu_action_t *action);
+static bool step_esc_item(menu_ctx_t *ctx, menu_action_t *action);
+#ifdef MENU_USE_VIRTUAL_LISTS
+static bool step_into_list(menu_ctx_t *ctx);
+static void step_out_of_list(menu_ctx_t *ctx);
+static bool step_list_by(menu_ctx_t *ctx, int32_t delta);
+static void get_list_entry_action(const menu_ctx_t *ctx, menu_action_t *action);
+#endif
+static bool is_menu_action_pending(const menu_action_t *action);
+static void run_menu_action(const menu_action_t *action);
+static bool apply_menu_event(menu_ctx_t *ctx, uint8_t event, menu_action_t *action);
+static menu_ref_t item_next(menu_source_t src, menu_ref_t item);
+static menu_ref_t item_child(menu_source_t src, menu_ref_t item);
+#ifndef MENU_USE_SLIM_NODES
+static menu_ref_t item_prev(menu_source_t src, menu_ref_t item);
+static menu_ref_t item_parent(menu_source_t src, menu_ref_t item);
+#endif
+static const char *item_name(menu_source_t src, menu_ref_t item);
+static menu_callback_t item_callback(menu_source_t src, menu_ref_t item);
+static bool is_menu_root_empty(const menu_root_t *root_menu);
+static bool is_item_in_source(menu_source_t src, menu_ref_t item);
+static bool are_item_links_valid(menu_source_t src, menu_ref_t item, menu_ref_t prev, menu_ref_t parent);
+static menu_status_t validate_menu_tree(menu_source_t src, menu_ref_t root);
+static menu_status_t walk_menu_tree_step(menu_tree_walk_t *walk);
+static bool is_list_item_with_submenu(menu_ref_t item, menu_ref_t child);
+static menu_status_t walk_into_child(menu_tree_walk_t *walk, menu_ref_t child);
+static menu_status_t walk_to_next_item(menu_tree_walk_t *walk);
+static bool count_level_item(menu_tree_walk_t *walk);
+static bool is_menu_validated(const menu_ctx_t *ctx, const menu_root_t *root_menu);
+static void remember_validated_menu(menu_ctx_t *ctx, menu_root_t *root_menu);
+static menu_status_t validate_menu_view(menu_ctx_t *ctx, menu_root_t *root_menu);
+static void initialize_menu_view_state(menu_ctx_t *ctx, menu_root_t *root_menu, menu_exit_cb_t menu_exit_cb, const char *custom_menu_header);
+static void render_menu_view(menu_ctx_t *ctx);
+static uint16_t get_window_top_index(const menu_ctx_t *ctx);
+static menu_ref_t get_window_top_item(const menu_ctx_t *ctx);
+static bool is_cursor_only_update_possible(const menu_ctx_t *ctx);
+static void update_cursor_marker(const menu_ctx_t *ctx);
+static void redraw_menu_view(menu_ctx_t *ctx);
+static bool is_row_compose_available(const menu_ctx_t *ctx);
+static bool is_shadow_buffer_in_use(const menu_ctx_t *ctx);
+static void write_menu_view_rows(menu_ctx_t *ctx);
+static void emit_menu_view_row(menu_ctx_t *ctx, uint8_t row, char *row_buf);
+#ifdef MENU_USE_SHADOW_BUFFER
+static void write_changed_spans(const menu_ctx_t *ctx, uint8_t row, char *row_buf);
+static uint8_t find_span_end(const menu_ctx_t *ctx, uint8_t row, const char *row_buf, uint8_t column);
+#endif
+static void compose_header_row(const menu_ctx_t *ctx, char *row_buf);
+static void start_view_iteration(const menu_ctx_t *ctx, menu_view_iter_t *iter);
+static const char *get_next_view_row_name(const menu_ctx_t *ctx, menu_view_iter_t *iter);
+static void compose_menu_item_row(const menu_ctx_t *ctx, char *row_buf, uint8_t row, const char *name);
+static uint8_t copy_text_to_row(const menu_ctx_t *ctx, char *row_buf, uint8_t column, const char *text);
+static uint8_t put_spaces_to_row(const menu_ctx_t *ctx, char *row_buf, uint8_t column, uint8_t qty);
+static void update_header_geometry(menu_ctx_t *ctx);
+static uint8_t get_text_length(const char *text);
+static uint8_t get_centered_column(const menu_ctx_t *ctx, uint8_t text_length);
+static const char *get_printable_name(const char *name);
+static void display_menu_header(const menu_ctx_t *ctx);
+static void display_header_title(const menu_ctx_t *ctx);
+static void fill_header_with_dashes(const menu_ctx_t *ctx);
+static void clear_current_menu_view_with_cursor(const menu_ctx_t *ctx);
+static void update_current_menu_view_with_cursor(const menu_ctx_t *ctx);
+static void display_cursor_marker_if_needed(const menu_ctx_t *ctx, uint8_t row);
+static void display_menu_item_name(const menu_ctx_t *ctx, uint8_t row, const char *name);
+static void print_text(const menu_ctx_t *ctx, uint8_t row, uint8_t column, const char *text);
 
 /* --- Implementation --- */
 
@@ -86,27 +309,7 @@ static void display_menu_item_name(uint8_t row, const char *name);
  */
 menu_status_t menu_init(void)
 {
-    menu_status_t status = MENU_OK;
-
-    DISPLAY = get_menu_display_driver_interface();
-
-    if (DISPLAY == NULL)
-    {
-        status = MENU_ERR_NO_DISPLAY_INTERFACE;
-    }
-    else if (!validate_display_interface(DISPLAY))
-    {
-        status = MENU_ERR_INCOMPLETE_INTERFACE;
-    }
-    else
-    {
-        menu_number_of_chars_per_line = DISPLAY->get_number_of_chars_per_line();
-        menu_number_of_screen_lines = DISPLAY->get_number_of_screen_lines();
-        DISPLAY->screen_init();
-    }
-
-    menu_initialized = (status == MENU_OK);
-    return status;
+    return menu_ctx_init(&menu_default_ctx, get_menu_display_driver_interface());
 }
 
 /**
@@ -123,403 +326,2385 @@ menu_status_t menu_init(void)
  * - MENU_ERR_NOT_INITIALIZED — Menu engine not initialized
  * - MENU_ERR_NO_MENU — root_menu pointer is NULL
  * - MENU_ERR_MENU_TOO_DEEP — Menu depth exceeds MAX_MENU_DEPTH
+ * - MENU_ERR_MALFORMED_MENU — Broken item links or a cycle in the menu tree
  */
-menu_status_t menu_view_init(menu_t *root_menu, menu_exit_cb_t menu_exit_cb, const char *custom_menu_header)
+menu_status_t menu_view_init(menu_root_t *root_menu, menu_exit_cb_t menu_exit_cb, const char *custom_menu_header)
 {
-    menu_status_t status = validate_menu_view(root_menu);
-
-    if (status == MENU_OK)
-    {
-        initialize_menu_view_state(root_menu, menu_exit_cb, custom_menu_header);
-    }
+    return menu_ctx_view_init(&menu_default_ctx, root_menu, menu_exit_cb, custom_menu_header);
+}
 
-    return status;
+/**
+ * @brief Forget the menu roots validated by menu_view_init().
+ */
+void menu_clear_validated_menus(void)
+{
+    menu_ctx_clear_validated_menus(&menu_default_ctx);
 }
 
 /**
  * @brief Move cursor to the next menu item.
- *
- * If the next menu item exists, updates the current pointer,
- * cursor selection index, and screen row position.
  */
 void menu_next(void)
 {
-    if (current_menu_pointer->next != NULL)
-    {
-        current_menu_pointer = current_menu_pointer->next;
-        cursor_selection_menu_index[menu_level]++;
-        if (cursor_row_position[menu_level] < (menu_number_of_screen_lines - 2U))
-        {
-            cursor_row_position[menu_level]++;
-        }
-        update_screen_view();
-    }
+    menu_ctx_next(&menu_default_ctx);
 }
 
 /**
  * @brief Move cursor to the previous menu item.
- *
- * If the previous menu item exists, updates the current pointer,
- * cursor selection index, and screen row position.
  */
 void menu_prev(void)
 {
-    if (current_menu_pointer->prev != NULL)
-    {
-        current_menu_pointer = current_menu_pointer->prev;
-        cursor_selection_menu_index[menu_level]--;
-        if (cursor_row_position[menu_level] != 0U)
-        {
-            cursor_row_position[menu_level]--;
-        }
-        update_screen_view();
-    }
+    menu_ctx_prev(&menu_default_ctx);
 }
 
 /**
  * @brief Enter submenu or execute item callback.
- *
- * If current item has a child menu, descend into submenu.
- * Otherwise, execute the callback function if present.
  */
 void menu_enter(void)
 {
-    if (current_menu_pointer->child != NULL)
-    {
-        menu_level++;
-        if (menu_level < MAX_MENU_DEPTH)
-        {
-            current_menu_pointer = current_menu_pointer->child;
-            cursor_selection_menu_index[menu_level] = 0U;
-            cursor_row_position[menu_level] = 0U;
-        }
-        else
-        {
-            menu_level--;
-        }
-        update_screen_view();
-    }
-    else if (current_menu_pointer->callback != NULL)
-    {
-        current_menu_pointer->callback();
-    }
+    menu_ctx_enter(&menu_default_ctx);
 }
 
 /**
  * @brief Exit current submenu or call top-level exit callback.
- *
- * Moves up one menu level if possible, or calls the top-level exit callback.
  */
 void menu_esc(void)
 {
-    if (current_menu_pointer->parent != NULL)
-    {
-        menu_level--;
-        current_menu_pointer = current_menu_pointer->parent;
-        update_screen_view();
-    }
-    else if (menu_top_level_exit_cb != NULL)
-    {
-        menu_top_level_exit_cb();
-    }
+    menu_ctx_esc(&menu_default_ctx);
 }
 
 /**
- * @brief Refresh the current screen view.
+ * @brief Move cursor by several menu items and render once.
  *
- * Updates header, clears menu area, adjusts item pointers,
- * and redraws menu items including cursor.
+ * @param delta Number of items to move (negative moves up).
+ */
+void menu_move_by(int16_t delta)
+{
+    menu_ctx_move_by(&menu_default_ctx, delta);
+}
+
+/**
+ * @brief Move cursor one page down.
+ */
+void menu_page_down(void)
+{
+    menu_ctx_page_down(&menu_default_ctx);
+}
+
+/**
+ * @brief Move cursor one page up.
+ */
+void menu_page_up(void)
+{
+    menu_ctx_page_up(&menu_default_ctx);
+}
+
+/**
+ * @brief Move cursor to the first item of the current menu level.
+ */
+void menu_first(void)
+{
+    menu_ctx_first(&menu_default_ctx);
+}
+
+/**
+ * @brief Move cursor to the last item of the current menu level.
+ */
+void menu_last(void)
+{
+    menu_ctx_last(&menu_default_ctx);
+}
+
+/**
+ * @brief Refresh the current screen view.
  */
 void update_screen_view(void)
 {
-    display_menu_header();
-    clear_current_menu_view_with_cursor();
-    update_menu_item_pointer_to_print();
-    update_current_menu_view_with_cursor();
+    menu_ctx_update_screen_view(&menu_default_ctx);
 }
 
 /**
- * @brief Get pointer to the currently selected menu item.
+ * @brief Select the rendering strategy used after navigation steps.
  *
- * @return menu_t* Pointer to the current menu.
+ * @param mode MENU_RENDER_FULL or MENU_RENDER_INCREMENTAL.
  */
-menu_t *get_current_menu_position(void)
+void menu_set_render_mode(menu_render_mode_t mode)
 {
-    return current_menu_pointer;
+    menu_ctx_set_render_mode(&menu_default_ctx, mode);
 }
 
-/* --- Private helper functions --- */
-
 /**
- * @brief Validate display driver interface.
+ * @brief Get pointer to the currently selected menu item.
  *
- * Checks that all required function pointers are non-NULL.
+ * @return menu_ref_t Pointer (or table index) of the current menu.
+ */
+menu_ref_t get_current_menu_position(void)
+{
+    return menu_ctx_get_current_menu_position(&menu_default_ctx);
+}
+
+/**
+ * @brief Queue a navigation event for menu_process().
  *
- * @param disp Pointer to the display driver interface.
- * @return true if valid, false otherwise.
+ * @param event Navigation event.
+ * @return menu_status_t MENU_OK or MENU_ERR_EVENT_QUEUE_FULL.
  */
-static bool validate_display_interface(const struct menu_screen_driver_interface_struct *disp)
+menu_status_t menu_post_event(menu_event_t event)
 {
-    return (disp != NULL) &&
-           (disp->get_number_of_chars_per_line != NULL) &&
-           (disp->get_number_of_screen_lines != NULL) &&
-           (disp->cursor_position != NULL) &&
-           (disp->print_string != NULL) &&
-           (disp->print_char != NULL);
+    return menu_ctx_post_event(&menu_default_ctx, event);
 }
 
 /**
- * @brief Recursively compute menu depth.
+ * @brief Apply all queued navigation events and render once.
+ */
+void menu_process(void)
+{
+    (void)menu_ctx_process(&menu_default_ctx);
+}
+
+/**
+ * @brief Initialize a menu context and its display interface.
  *
- * Determines maximum depth of menu tree starting from given node.
+ * Clears the whole context, validates the display driver, caches the
+ * screen geometry and initializes the screen.
  *
- * @param menu Pointer to a menu item.
- * @return uint8_t Depth level (1 for leaf node, 0 for NULL).
+ * @param ctx Context to initialize.
+ * @param display Display driver interface used by this context.
+ * @return menu_status_t
+ * - MENU_OK — Initialization successful
+ * - MENU_ERR_NO_CONTEXT — ctx is NULL
+ * - MENU_ERR_NO_DISPLAY_INTERFACE — Display driver interface missing
+ * - MENU_ERR_INCOMPLETE_INTERFACE — Display driver missing required functions
  */
-static uint8_t compute_menu_depth(const menu_t *menu)
+menu_status_t menu_ctx_init(menu_ctx_t *ctx, const struct menu_screen_driver_interface_struct *display)
 {
-    uint8_t depth = 0U;
+    menu_status_t status = MENU_ERR_NO_CONTEXT;
 
-    if (menu != NULL)
+    if (ctx != NULL)
     {
-        uint8_t max_child_depth = 0U;
-        const menu_t *child = menu->child;
-
-        while (child != NULL)
-        {
-            uint8_t child_depth = compute_menu_depth(child);
-            if (child_depth > max_child_depth)
-            {
-                max_child_depth = child_depth;
-            }
-            child = child->next;
-        }
-
-        depth = 1U + max_child_depth;
+        memset(ctx, 0, sizeof(*ctx));
+        ctx->render_mode = MENU_RENDER_FULL;
+        status = attach_display_interface(ctx, display);
+        ctx->initialized = (status == MENU_OK);
     }
 
-    return depth;
+    return status;
 }
 
 /**
- * @brief Validate menu view configuration.
- *
- * Ensures engine is initialized, the menu root is valid,
- * and the menu depth does not exceed the maximum allowed.
+ * @brief Initialize and display a menu view in the given context.
  *
+ * @param ctx Menu context.
  * @param root_menu Pointer to the root menu.
- * @return menu_status_t Validation result.
+ * @param menu_exit_cb Callback executed when the top-level menu is exited.
+ * @param custom_menu_header Optional custom header string (NULL for default).
+ * @return menu_status_t
+ * - MENU_OK — Menu view successfully initialized
+ * - MENU_ERR_NO_CONTEXT — ctx is NULL
+ * - MENU_ERR_NOT_INITIALIZED — Context not initialized
+ * - MENU_ERR_NO_MENU — root_menu pointer is NULL
+ * - MENU_ERR_MENU_TOO_DEEP — Menu depth exceeds MAX_MENU_DEPTH
+ * - MENU_ERR_MALFORMED_MENU — Broken item links or a cycle in the menu tree
  */
-static menu_status_t validate_menu_view(const menu_t *root_menu)
+menu_status_t menu_ctx_view_init(menu_ctx_t *ctx, menu_root_t *root_menu, menu_exit_cb_t menu_exit_cb, const char *custom_menu_header)
 {
-    menu_status_t status = MENU_OK;
+    menu_status_t status = validate_menu_view(ctx, root_menu);
 
-    if (!menu_initialized)
+    if (status == MENU_OK)
     {
-        status = MENU_ERR_NOT_INITIALIZED;
+        initialize_menu_view_state(ctx, root_menu, menu_exit_cb, custom_menu_header);
     }
-    else if (root_menu == NULL)
+
+    return status;
+}
+
+/**
+ * @brief Forget the menu roots validated in the given context.
+ *
+ * @param ctx Menu context.
+ */
+void menu_ctx_clear_validated_menus(menu_ctx_t *ctx)
+{
+    if (ctx != NULL)
     {
-        status = MENU_ERR_NO_MENU;
+        memset(ctx->validated_menus, 0, sizeof(ctx->validated_menus));
+        ctx->validated_menus_next = 0U;
     }
-    else if (compute_menu_depth(root_menu) > MAX_MENU_DEPTH)
+}
+
+/**
+ * @brief Move cursor to the next menu item.
+ *
+ * If the next menu item exists, updates the current pointer,
+ * cursor selection index, and screen row position.
+ *
+ * @param ctx Menu context.
+ */
+void menu_ctx_next(menu_ctx_t *ctx)
+{
+    if (ctx != NULL)
     {
-        status = MENU_ERR_MENU_TOO_DEEP;
+        MENU_TRACE_BEGIN(ctx, MENU_TRACE_NEXT);
+        if (step_by(ctx, 1))
+        {
+            render_menu_view(ctx);
+        }
+        MENU_TRACE_END(ctx, MENU_TRACE_NEXT);
     }
-
-    return status;
 }
 
 /**
- * @brief Initialize menu view internal state.
+ * @brief Move cursor to the previous menu item.
  *
- * Sets current menu, first item, cursor positions, and top-level exit callback.
+ * If the previous menu item exists, updates the current pointer,
+ * cursor selection index, and screen row position.
  *
- * @param root_menu Root menu pointer
- * @param menu_exit_cb Top-level exit callback
- * @param custom_menu_header Optional custom header
+ * @param ctx Menu context.
  */
-static void initialize_menu_view_state(menu_t *root_menu, menu_exit_cb_t menu_exit_cb, const char *custom_menu_header)
+void menu_ctx_prev(menu_ctx_t *ctx)
 {
-    current_menu_pointer = root_menu;
-    menu_1st_item = root_menu;
-    menu_level = 0U;
-    cursor_selection_menu_index[menu_level] = 0U;
-    cursor_row_position[menu_level] = 0U;
-    menu_top_level_exit_cb = menu_exit_cb;
-    custom_header = custom_menu_header;
-
-    update_screen_view();
+    if (ctx != NULL)
+    {
+        MENU_TRACE_BEGIN(ctx, MENU_TRACE_PREV);
+        if (step_by(ctx, -1))
+        {
+            render_menu_view(ctx);
+        }
+        MENU_TRACE_END(ctx, MENU_TRACE_PREV);
+    }
 }
 
 /**
- * @brief Display appropriate menu header (main or submenu).
+ * @brief Enter submenu or execute item callback.
+ *
+ * If current item has a child menu, descend into submenu.
+ * Otherwise, execute the callback function if present.
+ *
+ * @param ctx Menu context.
  */
-static void display_menu_header(void)
+void menu_ctx_enter(menu_ctx_t *ctx)
 {
-    fill_header_with_dashes();
+    if (ctx != NULL)
+    {
+        menu_action_t action = {0};
 
-    if (current_menu_pointer->parent == NULL)
-        display_main_menu_header();
-    else
-        display_sub_menu_header();
+        MENU_TRACE_BEGIN(ctx, MENU_TRACE_ENTER);
+        if (step_enter(ctx, &action))
+        {
+            render_menu_view(ctx);
+        }
+        else
+        {
+            run_menu_action(&action);
+        }
+        MENU_TRACE_END(ctx, MENU_TRACE_ENTER);
+    }
 }
 
 /**
- * @brief Displays the main menu header (top-level view).
+ * @brief Exit current submenu or call top-level exit callback.
  *
- * Centers the custom header if provided; otherwise, uses default column.
- * Sets menu_item_2_print to first menu item for rendering.
+ * Moves up one menu level if possible, or calls the top-level exit callback.
+ *
+ * @param ctx Menu context.
  */
-static void display_main_menu_header(void)
+void menu_ctx_esc(menu_ctx_t *ctx)
 {
-    const char *header_str = default_header;
-    uint8_t column = DEFAULT_MENU_HEADER_COLUMN;
-
-    if (custom_header != NULL)
+    if (ctx != NULL)
     {
-        header_str = custom_header;
-        const uint8_t header_length = (uint8_t)strlen(custom_header);
+        menu_action_t action = {0};
 
-        /* Center custom header on the screen if it fits */
-        if (menu_number_of_chars_per_line > header_length)
+        MENU_TRACE_BEGIN(ctx, MENU_TRACE_ESC);
+        if (step_esc(ctx, &action))
         {
-            column = (menu_number_of_chars_per_line - header_length) / 2U;
+            render_menu_view(ctx);
         }
         else
         {
-            /* Fallback to first column if header is longer than screen width */
-            column = FIRST_COLUMN;
+            run_menu_action(&action);
         }
+        MENU_TRACE_END(ctx, MENU_TRACE_ESC);
     }
-
-    /* Move cursor and print header */
-    DISPLAY->cursor_position(FIRST_ROW, column);
-    DISPLAY->print_string(header_str);
-
-    /* Set pointer to first menu item for rendering */
-    menu_item_2_print = menu_1st_item;
 }
 
 /**
- * @brief Display header for submenu.
+ * @brief Move cursor by several menu items and render once.
+ *
+ * The selection index, cursor row and window top are updated step by step
+ * while the sibling list is walked once; the view is rendered only after
+ * the walk. The move stops at the first or the last item of the level.
  *
- * Centers parent menu name with padding and sets
- * menu_item_2_print to first child menu item.
+ * @param ctx Menu context.
+ * @param delta Number of items to move (negative moves up).
  */
-static void display_sub_menu_header(void)
+void menu_ctx_move_by(menu_ctx_t *ctx, int16_t delta)
 {
-    const char *parent_name = current_menu_pointer->parent->name;
-    uint8_t header_len = (uint8_t)strlen(parent_name) + ADDITIONAL_SPACE_CHAR_QTY;
-    uint8_t header_start;
-
-    /* Center header on screen if it fits, otherwise start at first column */
-    if (menu_number_of_chars_per_line > header_len)
-    {
-        header_start = (menu_number_of_chars_per_line - header_len) / 2U;
-    }
-    else
+    if ((ctx != NULL) && step_by(ctx, (int32_t)delta))
     {
-        header_start = FIRST_COLUMN;
+        render_menu_view(ctx);
     }
-
-    /* Move cursor and print header with padding */
-    DISPLAY->cursor_position(FIRST_ROW, header_start);
-    DISPLAY->print_char(' ');
-    DISPLAY->print_string(parent_name);
-    DISPLAY->print_char(' ');
-
-    /* Set pointer to first child menu item for rendering */
-    menu_item_2_print = current_menu_pointer->parent->child;
 }
 
 /**
- * @brief Fill header row with dash characters.
+ * @brief Move cursor down by the number of menu rows on the screen.
+ *
+ * @param ctx Menu context.
  */
-static void fill_header_with_dashes(void)
+void menu_ctx_page_down(menu_ctx_t *ctx)
 {
-    DISPLAY->cursor_position(FIRST_ROW, FIRST_COLUMN);
-    for (uint8_t i = 0U; i < menu_number_of_chars_per_line; i++)
-        DISPLAY->print_char('-');
+    if (ctx != NULL)
+    {
+        menu_ctx_move_by(ctx, (int16_t)get_menu_view_rows(ctx));
+    }
 }
 
 /**
- * @brief Clear the menu view area on the screen.
+ * @brief Move cursor up by the number of menu rows on the screen.
+ *
+ * @param ctx Menu context.
  */
-static void clear_current_menu_view_with_cursor(void)
+void menu_ctx_page_up(menu_ctx_t *ctx)
 {
-    for (uint8_t i = MENU_VIEW_FIRST_ROW; i < menu_number_of_screen_lines; i++)
+    if (ctx != NULL)
     {
-        DISPLAY->cursor_position(i, FIRST_COLUMN);
-        for (uint8_t j = 0U; j < menu_number_of_chars_per_line; j++)
-            DISPLAY->print_char(' ');
+        menu_ctx_move_by(ctx, -(int16_t)get_menu_view_rows(ctx));
     }
 }
 
 /**
- * @brief Adjust pointer to the first menu item to print.
+ * @brief Move cursor to the first item of the current menu level.
  *
- * Calculates offset from cursor selection index to row position.
+ * @param ctx Menu context.
  */
-static void update_menu_item_pointer_to_print(void)
+void menu_ctx_first(menu_ctx_t *ctx)
 {
-    uint8_t offset = cursor_selection_menu_index[menu_level] - cursor_row_position[menu_level];
-    for (uint8_t i = 0U; i < offset; i++)
+    if ((ctx != NULL) && step_by(ctx, -(int32_t)ctx->cursor_selection_menu_index[ctx->menu_level]))
     {
-        if (menu_item_2_print == NULL)
-            break;
-        menu_item_2_print = menu_item_2_print->next;
+        render_menu_view(ctx);
     }
 }
 
 /**
- * @brief Render visible menu items with cursor.
+ * @brief Move cursor to the last item of the current menu level.
+ *
+ * @param ctx Menu context.
  */
-static void update_current_menu_view_with_cursor(void)
+void menu_ctx_last(menu_ctx_t *ctx)
 {
-    for (uint8_t row = MENU_VIEW_FIRST_ROW; row < menu_number_of_screen_lines; row++)
+    if ((ctx != NULL) && step_by(ctx, (int32_t)UINT16_MAX))
     {
-        display_cursor_marker_if_needed(row);
+        render_menu_view(ctx);
+    }
+}
 
-        if (menu_item_2_print == NULL)
-        {
+/**
+ * @brief Queue a navigation event for menu_ctx_process().
+ *
+ * Producer side of the single-producer/single-consumer event ring. Only
+ * event_head is written, so the call is safe from an ISR while the main
+ * loop runs menu_ctx_process(). The display is not touched.
+ *
+ * @param ctx Menu context.
+ * @param event Navigation event.
+ * @return menu_status_t
+ * - MENU_OK — Event queued
+ * - MENU_ERR_NO_CONTEXT — ctx is NULL
+ * - MENU_ERR_EVENT_QUEUE_FULL — Queue full, event dropped
+ */
+menu_status_t menu_ctx_post_event(menu_ctx_t *ctx, menu_event_t event)
+{
+    menu_status_t status = MENU_ERR_NO_CONTEXT;
+
+    if (ctx != NULL)
+    {
+        uint8_t head = ctx->event_head;
+
+        if ((uint8_t)(head - ctx->event_tail) < MENU_EVENT_QUEUE_SIZE)
+        {
+            ctx->event_queue[head & EVENT_QUEUE_INDEX_MASK] = (uint8_t)event;
+            ctx->event_head = (uint8_t)(head + 1U);
+            status = MENU_OK;
+        }
+        else
+        {
+            status = MENU_ERR_EVENT_QUEUE_FULL;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief Apply all queued navigation events and render once.
+ *
+ * Consumer side of the event ring, call it from the main loop only.
+ * When an event runs an item callback, the top-level exit callback or a
+ * virtual list on_select(), the
+ * pending view is rendered first, events still queued behind it are
+ * discarded (they were aimed at the menu the callback has just left) and
+ * the callback is called last.
+ *
+ * @param ctx Menu context.
+ * @return menu_status_t
+ * - MENU_OK — Queued events processed
+ * - MENU_ERR_NO_CONTEXT — ctx is NULL
+ */
+menu_status_t menu_ctx_process(menu_ctx_t *ctx)
+{
+    menu_status_t status = MENU_ERR_NO_CONTEXT;
+
+    if (ctx != NULL)
+    {
+        menu_action_t action = {0};
+        bool render_pending = false;
+        uint8_t tail = ctx->event_tail;
+
+        while (!is_menu_action_pending(&action) && (tail != ctx->event_head))
+        {
+            uint8_t event = ctx->event_queue[tail & EVENT_QUEUE_INDEX_MASK];
+
+            tail++;
+            ctx->event_tail = tail;
+            if (apply_menu_event(ctx, event, &action))
+            {
+                render_pending = true;
+            }
+        }
+        if (render_pending)
+        {
+            render_menu_view(ctx);
+        }
+        if (is_menu_action_pending(&action))
+        {
+            ctx->event_tail = ctx->event_head;
+            run_menu_action(&action);
+        }
+        status = MENU_OK;
+    }
+
+    return status;
+}
+
+/**
+ * @brief Refresh the current screen view.
+ *
+ * Forces a full redraw of the header and all menu rows, regardless
+ * of the selected render mode.
+ *
+ * @param ctx Menu context.
+ */
+void menu_ctx_update_screen_view(menu_ctx_t *ctx)
+{
+    if (ctx != NULL)
+    {
+        ctx->screen_view_valid = false;
+#ifdef MENU_USE_SHADOW_BUFFER
+        ctx->shadow_buffer_valid = false;
+#endif
+        render_menu_view(ctx);
+    }
+}
+
+/**
+ * @brief Select the rendering strategy used after navigation steps.
+ *
+ * @param ctx Menu context.
+ * @param mode MENU_RENDER_FULL or MENU_RENDER_INCREMENTAL.
+ */
+void menu_ctx_set_render_mode(menu_ctx_t *ctx, menu_render_mode_t mode)
+{
+    if (ctx != NULL)
+    {
+        ctx->render_mode = mode;
+        ctx->screen_view_valid = false;
+#ifdef MENU_USE_SHADOW_BUFFER
+        ctx->shadow_buffer_valid = false;
+#endif
+    }
+}
+
+/**
+ * @brief Get pointer to the currently selected menu item.
+ *
+ * @param ctx Menu context.
+ * @return menu_ref_t Pointer (or table index) of the current menu,
+ * MENU_NO_NODE when ctx is NULL.
+ */
+menu_ref_t menu_ctx_get_current_menu_position(const menu_ctx_t *ctx)
+{
+    menu_ref_t position = MENU_NO_NODE;
+
+    if (ctx != NULL)
+    {
+        position = ctx->current_menu_pointer;
+    }
+
+    return position;
+}
+
+#ifdef MENU_USE_TRACE
+/**
+ * @brief Set the function used to timestamp trace records.
+ *
+ * @param tick Tick source, NULL writes 0 timestamps.
+ */
+void menu_trace_set_tick_source(menu_trace_tick_func_ptr tick)
+{
+    menu_trace_tick = tick;
+}
+
+/**
+ * @brief Write one record to the trace ring, overwriting the oldest one when full.
+ *
+ * @param event Record id.
+ * @param level Menu level or display row.
+ * @param index Selection index, display column or length.
+ */
+void menu_trace_record(uint8_t event, uint8_t level, uint16_t index)
+{
+    menu_trace_record_t *record = &menu_trace_ring[menu_trace_head & TRACE_INDEX_MASK];
+
+    record->event = event;
+    record->level = level;
+    record->index = index;
+    record->timestamp = (menu_trace_tick != NULL) ? menu_trace_tick() : 0U;
+    menu_trace_head++;
+    if (menu_trace_count < MENU_TRACE_BUFFER_SIZE)
+    {
+        menu_trace_count++;
+    }
+}
+
+/**
+ * @brief Copy the recorded trace, oldest record first.
+ *
+ * @param records Destination buffer.
+ * @param max_records Capacity of the destination buffer.
+ * @return uint16_t Number of copied records.
+ */
+uint16_t menu_trace_read(menu_trace_record_t *records, uint16_t max_records)
+{
+    uint16_t records_qty = (menu_trace_count < max_records) ? menu_trace_count : max_records;
+    uint16_t slot = (uint16_t)(menu_trace_head - records_qty);
+
+    for (uint16_t i = 0U; i < records_qty; i++)
+    {
+        records[i] = menu_trace_ring[slot & TRACE_INDEX_MASK];
+        slot++;
+    }
+
+    return records_qty;
+}
+
+/**
+ * @brief Remove all records from the trace ring.
+ */
+void menu_trace_clear(void)
+{
+    menu_trace_head = 0U;
+    menu_trace_count = 0U;
+}
+
+/**
+ * @brief Send the recorded trace as a little endian binary dump, oldest record first.
+ *
+ * @param write Byte sink called once for the header and once per record.
+ */
+void menu_trace_dump(menu_trace_write_func_ptr write)
+{
+    const uint8_t header[TRACE_DUMP_RECORD_SIZE] = {'M', 'T', 'R', 'C',
+                                                    TRACE_DUMP_VERSION,
+                                                    TRACE_DUMP_RECORD_SIZE,
+                                                    (uint8_t)menu_trace_count,
+                                                    (uint8_t)(menu_trace_count >> 8)};
+    uint16_t slot = (uint16_t)(menu_trace_head - menu_trace_count);
+
+    write(header, TRACE_DUMP_RECORD_SIZE);
+    for (uint16_t i = 0U; i < menu_trace_count; i++)
+    {
+        const menu_trace_record_t *record = &menu_trace_ring[slot & TRACE_INDEX_MASK];
+        const uint8_t data[TRACE_DUMP_RECORD_SIZE] = {record->event,
+                                                      record->level,
+                                                      (uint8_t)record->index,
+                                                      (uint8_t)(record->index >> 8),
+                                                      (uint8_t)record->timestamp,
+                                                      (uint8_t)(record->timestamp >> 8),
+                                                      (uint8_t)(record->timestamp >> 16),
+                                                      (uint8_t)(record->timestamp >> 24)};
+
+        write(data, TRACE_DUMP_RECORD_SIZE);
+        slot++;
+    }
+}
+#endif
+
+/* --- Private helper functions --- */
+
+/**
+ * @brief Move the selection by several items without rendering.
+ *
+ * @param ctx Menu context.
+ * @param delta Number of items to move (negative moves up).
+ * @return true if the selection changed.
+ */
+static bool step_by(menu_ctx_t *ctx, int32_t delta)
+{
+#ifdef MENU_USE_VIRTUAL_LISTS
+    return (ctx->active_list != NULL) ? step_list_by(ctx, delta) : walk_items_by(ctx, delta);
+#else
+    return walk_items_by(ctx, delta);
+#endif
+}
+
+/**
+ * @brief Walk the sibling list of the current level by several items.
+ *
+ * @param ctx Menu context.
+ * @param delta Number of items to move (negative moves up).
+ * @return true if the selection changed.
+ */
+static bool walk_items_by(menu_ctx_t *ctx, int32_t delta)
+{
+    bool moved = false;
+    int32_t steps = delta;
+
+    while ((steps > 0) && step_next_item(ctx))
+    {
+        moved = true;
+        steps--;
+    }
+    while ((steps < 0) && step_prev_item(ctx))
+    {
+        moved = true;
+        steps++;
+    }
+
+    return moved;
+}
+
+/**
+ * @brief Select the next menu item without rendering.
+ *
+ * @param ctx Menu context.
+ * @return true if the selection changed.
+ */
+static bool step_next_item(menu_ctx_t *ctx)
+{
+    uint8_t level = ctx->menu_level;
+    menu_ref_t next = item_next(MENU_SOURCE(ctx), ctx->current_menu_pointer);
+
+    if (next != MENU_NO_NODE)
+    {
+        ctx->current_menu_pointer = next;
+        ctx->cursor_selection_menu_index[level]++;
+        if (ctx->cursor_row_position[level] < (ctx->screen_lines - 2U))
+        {
+            ctx->cursor_row_position[level]++;
+        }
+        else
+        {
+            ctx->window_top_menu[level] = item_next(MENU_SOURCE(ctx), ctx->window_top_menu[level]);
+        }
+    }
+
+    return (next != MENU_NO_NODE);
+}
+
+/**
+ * @brief Select the previous menu item without rendering.
+ *
+ * @param ctx Menu context.
+ * @return true if the selection changed.
+ */
+static bool step_prev_item(menu_ctx_t *ctx)
+{
+    uint8_t level = ctx->menu_level;
+    menu_ref_t prev = get_prev_item(ctx);
+
+    if (prev != MENU_NO_NODE)
+    {
+        ctx->current_menu_pointer = prev;
+        ctx->cursor_selection_menu_index[level]--;
+        if (ctx->cursor_row_position[level] != 0U)
+        {
+            ctx->cursor_row_position[level]--;
+        }
+        else
+        {
+            ctx->window_top_menu[level] = ctx->current_menu_pointer;
+        }
+    }
+
+    return (prev != MENU_NO_NODE);
+}
+
+/**
+ * @brief Item before the current one on the current level.
+ *
+ * Slim nodes have no prev link: the level is walked forward from the cached
+ * window top, which is at most one screen above the current item, or from
+ * the first item of the level when the current item is the window top.
+ *
+ * @param ctx Menu context.
+ * @return menu_ref_t Previous item or MENU_NO_NODE for the first item.
+ */
+static menu_ref_t get_prev_item(const menu_ctx_t *ctx)
+{
+#ifdef MENU_USE_SLIM_NODES
+    uint8_t level = ctx->menu_level;
+    menu_ref_t item = ctx->window_top_menu[level];
+    menu_ref_t prev = MENU_NO_NODE;
+
+    if (item == ctx->current_menu_pointer)
+    {
+        item = (level > 0U) ? ctx->menu_path[level - 1U]->child : ctx->root_menu_item;
+    }
+    while (item != ctx->current_menu_pointer)
+    {
+        prev = item;
+        item = item->next;
+    }
+
+    return prev;
+#else
+    return item_prev(MENU_SOURCE(ctx), ctx->current_menu_pointer);
+#endif
+}
+
+/**
+ * @brief Item that opened the current level.
+ *
+ * @param ctx Menu context.
+ * @return menu_ref_t Parent item or MENU_NO_NODE on the top level.
+ */
+static menu_ref_t get_parent_item(const menu_ctx_t *ctx)
+{
+#ifdef MENU_USE_SLIM_NODES
+    return (ctx->menu_level > 0U) ? ctx->menu_path[ctx->menu_level - 1U] : MENU_NO_NODE;
+#else
+    return item_parent(MENU_SOURCE(ctx), ctx->current_menu_pointer);
+#endif
+}
+
+/**
+ * @brief Get the number of screen rows used for menu items.
+ *
+ * @param ctx Menu context.
+ * @return uint8_t Screen lines without the header row.
+ */
+static uint8_t get_menu_view_rows(const menu_ctx_t *ctx)
+{
+    return (uint8_t)(ctx->screen_lines - HEADER_ROW_OFFSET);
+}
+
+/**
+ * @brief Enter the current item without rendering.
+ *
+ * @param ctx Menu context.
+ * @param action Set to the code to run when the item is a leaf.
+ * @return true if the view has to be rendered.
+ */
+static bool step_enter(menu_ctx_t *ctx, menu_action_t *action)
+{
+#ifdef MENU_USE_VIRTUAL_LISTS
+    bool view_changed = false;
+
+    if (ctx->active_list != NULL)
+    {
+        get_list_entry_action(ctx, action);
+    }
+    else if (ctx->current_menu_pointer->list != NULL)
+    {
+        view_changed = step_into_list(ctx);
+    }
+    else
+    {
+        view_changed = step_enter_item(ctx, action);
+    }
+
+    return view_changed;
+#else
+    return step_enter_item(ctx, action);
+#endif
+}
+
+/**
+ * @brief Descend into the submenu of the current item without rendering.
+ *
+ * For a leaf item the state is not changed and the item callback is
+ * returned to the caller instead of being executed.
+ *
+ * @param ctx Menu context.
+ * @param action Set to the item callback when the current item is a leaf.
+ * @return true if the view has to be rendered.
+ */
+static bool step_enter_item(menu_ctx_t *ctx, menu_action_t *action)
+{
+    menu_ref_t child = item_child(MENU_SOURCE(ctx), ctx->current_menu_pointer);
+
+    if (child != MENU_NO_NODE)
+    {
+        ctx->menu_level++;
+        if (ctx->menu_level < MAX_MENU_DEPTH)
+        {
+#ifdef MENU_USE_SLIM_NODES
+            ctx->menu_path[ctx->menu_level - 1U] = ctx->current_menu_pointer;
+#endif
+            ctx->current_menu_pointer = child;
+            ctx->cursor_selection_menu_index[ctx->menu_level] = 0U;
+            ctx->cursor_row_position[ctx->menu_level] = 0U;
+            ctx->window_top_menu[ctx->menu_level] = ctx->current_menu_pointer;
+            ctx->screen_view_valid = false;
+            update_header_geometry(ctx);
+        }
+        else
+        {
+            ctx->menu_level--;
+        }
+    }
+    else
+    {
+        action->callback = item_callback(MENU_SOURCE(ctx), ctx->current_menu_pointer);
+    }
+
+    return (child != MENU_NO_NODE);
+}
+
+/**
+ * @brief Leave the current menu level without rendering.
+ *
+ * @param ctx Menu context.
+ * @param action Set to the top-level exit callback at the top level.
+ * @return true if the view has to be rendered.
+ */
+static bool step_esc(menu_ctx_t *ctx, menu_action_t *action)
+{
+#ifdef MENU_USE_VIRTUAL_LISTS
+    bool view_changed = true;
+
+    if (ctx->active_list != NULL)
+    {
+        step_out_of_list(ctx);
+    }
+    else
+    {
+        view_changed = step_esc_item(ctx, action);
+    }
+
+    return view_changed;
+#else
+    return step_esc_item(ctx, action);
+#endif
+}
+
+/**
+ * @brief Return to the parent menu without rendering.
+ *
+ * At the top level the state is not changed and the top-level exit
+ * callback is returned to the caller instead of being executed.
+ *
+ * @param ctx Menu context.
+ * @param action Set to the top-level exit callback at the top level.
+ * @return true if the view has to be rendered.
+ */
+static bool step_esc_item(menu_ctx_t *ctx, menu_action_t *action)
+{
+    menu_ref_t parent = get_parent_item(ctx);
+
+    if (parent != MENU_NO_NODE)
+    {
+        ctx->menu_level--;
+        ctx->current_menu_pointer = parent;
+        ctx->screen_view_valid = false;
+        update_header_geometry(ctx);
+    }
+    else
+    {
+        action->callback = ctx->menu_top_level_exit_cb;
+    }
+
+    return (parent != MENU_NO_NODE);
+}
+
+#ifdef MENU_USE_VIRTUAL_LISTS
+/**
+ * @brief Open the virtual list of the current item without rendering.
+ *
+ * The item that owns the list stays the current menu item; the list level
+ * is described by the selection index and cursor row only.
+ *
+ * @param ctx Menu context.
+ * @return true, the view has to be rendered.
+ */
+static bool step_into_list(menu_ctx_t *ctx)
+{
+    uint8_t level = ctx->menu_level + 1U;
+
+    if (level < MAX_MENU_DEPTH)
+    {
+        ctx->menu_level = level;
+        ctx->active_list = ctx->current_menu_pointer->list;
+        ctx->cursor_selection_menu_index[level] = 0U;
+        ctx->cursor_row_position[level] = 0U;
+        ctx->window_top_menu[level] = MENU_NO_NODE;
+        ctx->screen_view_valid = false;
+        update_header_geometry(ctx);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Close the virtual list without rendering.
+ *
+ * The item that opened the list stays selected on the level below.
+ *
+ * @param ctx Menu context.
+ */
+static void step_out_of_list(menu_ctx_t *ctx)
+{
+    ctx->active_list = NULL;
+    ctx->menu_level--;
+    ctx->screen_view_valid = false;
+    update_header_geometry(ctx);
+}
+
+/**
+ * @brief Move the selection in the virtual list without rendering.
+ *
+ * The selection index and the cursor row are computed arithmetically, the
+ * provider is asked for the number of entries only.
+ *
+ * @param ctx Menu context.
+ * @param delta Number of entries to move (negative moves up).
+ * @return true if the selection changed.
+ */
+static bool step_list_by(menu_ctx_t *ctx, int32_t delta)
+{
+    uint8_t level = ctx->menu_level;
+    int32_t index = (int32_t)ctx->cursor_selection_menu_index[level];
+    int32_t last_index = (int32_t)ctx->active_list->count() - 1;
+    int32_t target = index + delta;
+
+    if (target > last_index)
+    {
+        target = last_index;
+    }
+    if (target < 0)
+    {
+        target = 0;
+    }
+    if (target != index)
+    {
+        int32_t row = (int32_t)ctx->cursor_row_position[level] + (target - index);
+        int32_t last_row = (int32_t)get_menu_view_rows(ctx) - 1;
+
+        if (row > last_row)
+        {
+            row = last_row;
+        }
+        if (row < 0)
+        {
+            row = 0;
+        }
+        ctx->cursor_selection_menu_index[level] = (uint16_t)target;
+        ctx->cursor_row_position[level] = (uint8_t)row;
+    }
+
+    return (target != index);
+}
+
+/**
+ * @brief Get the on_select call for the selected virtual list entry.
+ *
+ * @param ctx Menu context.
+ * @param action Set to the provider on_select and the entry index.
+ */
+static void get_list_entry_action(const menu_ctx_t *ctx, menu_action_t *action)
+{
+    uint16_t index = ctx->cursor_selection_menu_index[ctx->menu_level];
+
+    if (index < ctx->active_list->count())
+    {
+        action->list_select = ctx->active_list->on_select;
+        action->list_index = index;
+    }
+}
+#endif /* MENU_USE_VIRTUAL_LISTS */
+
+/**
+ * @brief Check if a navigation step left code to run.
+ *
+ * @param action Action filled by a navigation step.
+ * @return true if run_menu_action() would call a function.
+ */
+static bool is_menu_action_pending(const menu_action_t *action)
+{
+#ifdef MENU_USE_VIRTUAL_LISTS
+    return (action->callback != NULL) || (action->list_select != NULL);
+#else
+    return (action->callback != NULL);
+#endif
+}
+
+/**
+ * @brief Run the code left by a navigation step.
+ *
+ * @param action Action filled by a navigation step.
+ */
+static void run_menu_action(const menu_action_t *action)
+{
+    if (action->callback != NULL)
+    {
+        action->callback();
+    }
+#ifdef MENU_USE_VIRTUAL_LISTS
+    if (action->list_select != NULL)
+    {
+        action->list_select(action->list_index);
+    }
+#endif
+}
+
+/**
+ * @brief Apply one queued navigation event without rendering.
+ *
+ * Unknown event codes are ignored.
+ *
+ * @param ctx Menu context.
+ * @param event menu_event_t value read from the event ring.
+ * @param action Set to the code the event has to run, if any.
+ * @return true if the view has to be rendered.
+ */
+static bool apply_menu_event(menu_ctx_t *ctx, uint8_t event, menu_action_t *action)
+{
+    bool view_changed = false;
+
+    switch (event)
+    {
+    case MENU_EVENT_NEXT:
+        view_changed = step_by(ctx, 1);
+        break;
+    case MENU_EVENT_PREV:
+        view_changed = step_by(ctx, -1);
+        break;
+    case MENU_EVENT_ENTER:
+        view_changed = step_enter(ctx, action);
+        break;
+    case MENU_EVENT_ESC:
+        view_changed = step_esc(ctx, action);
+        break;
+    default:
+        break;
+    }
+
+    return view_changed;
+}
+
+/**
+ * @brief Validate and attach display driver interface to the context.
+ *
+ * Caches the screen geometry and initializes the screen on success.
+ *
+ * @param ctx Menu context.
+ * @param display Display driver interface.
+ * @return menu_status_t
+ * - MENU_OK — Display attached
+ * - MENU_ERR_NO_DISPLAY_INTERFACE — Display driver interface missing
+ * - MENU_ERR_INCOMPLETE_INTERFACE — Display driver missing required functions
+ */
+static menu_status_t attach_display_interface(menu_ctx_t *ctx, const struct menu_screen_driver_interface_struct *display)
+{
+    menu_status_t status = MENU_OK;
+
+    ctx->display = display;
+
+    if (display == NULL)
+    {
+        status = MENU_ERR_NO_DISPLAY_INTERFACE;
+    }
+    else if (!validate_display_interface(display))
+    {
+        status = MENU_ERR_INCOMPLETE_INTERFACE;
+    }
+    else
+    {
+        ctx->chars_per_line = display->get_number_of_chars_per_line();
+        ctx->screen_lines = display->get_number_of_screen_lines();
+        MENU_TRACE_DRIVER(MENU_TRACE_DRV_SCREEN_INIT, FIRST_ROW, FIRST_COLUMN);
+        display->screen_init();
+    }
+
+    return status;
+}
+
+/**
+ * @brief Validate display driver interface.
+ *
+ * Checks that all required function pointers are non-NULL. With
+ * MENU_USE_STATIC_DRIVER the drawing entries are bound at compile time,
+ * so only the geometry getters are required.
+ *
+ * @param disp Pointer to the display driver interface.
+ * @return true if valid, false otherwise.
+ */
+static bool validate_display_interface(const struct menu_screen_driver_interface_struct *disp)
+{
+#ifdef MENU_USE_STATIC_DRIVER
+    return (disp != NULL) &&
+           (disp->get_number_of_chars_per_line != NULL) &&
+           (disp->get_number_of_screen_lines != NULL);
+#else
+    return (disp != NULL) &&
+           (disp->get_number_of_chars_per_line != NULL) &&
+           (disp->get_number_of_screen_lines != NULL) &&
+           (disp->cursor_position != NULL) &&
+           (disp->print_string != NULL) &&
+           (disp->print_char != NULL);
+#endif
+}
+
+#ifndef MENU_USE_COMPACT_TABLE
+/**
+ * @brief Next item on the same level.
+ *
+ * @param src Unused for pointer linked items.
+ * @param item Menu item.
+ * @return menu_ref_t Next item or MENU_NO_NODE.
+ */
+static menu_ref_t item_next(menu_source_t src, menu_ref_t item)
+{
+    (void)src;
+    return item->next;
+}
+
+/**
+ * @brief First item of the submenu.
+ *
+ * @param src Unused for pointer linked items.
+ * @param item Menu item.
+ * @return menu_ref_t Child item or MENU_NO_NODE.
+ */
+static menu_ref_t item_child(menu_source_t src, menu_ref_t item)
+{
+    (void)src;
+    return item->child;
+}
+
+#ifndef MENU_USE_SLIM_NODES
+/**
+ * @brief Previous item on the same level.
+ *
+ * @param src Unused for pointer linked items.
+ * @param item Menu item.
+ * @return menu_ref_t Previous item or MENU_NO_NODE.
+ */
+static menu_ref_t item_prev(menu_source_t src, menu_ref_t item)
+{
+    (void)src;
+    return item->prev;
+}
+
+/**
+ * @brief Parent item.
+ *
+ * @param src Unused for pointer linked items.
+ * @param item Menu item.
+ * @return menu_ref_t Parent item or MENU_NO_NODE on the top level.
+ */
+static menu_ref_t item_parent(menu_source_t src, menu_ref_t item)
+{
+    (void)src;
+    return item->parent;
+}
+#endif /* MENU_USE_SLIM_NODES */
+
+/**
+ * @brief Name of the item.
+ *
+ * @param src Unused for pointer linked items.
+ * @param item Menu item.
+ * @return const char* Item name (may be NULL).
+ */
+static const char *item_name(menu_source_t src, menu_ref_t item)
+{
+    (void)src;
+    return item->name;
+}
+
+/**
+ * @brief Callback of the item.
+ *
+ * @param src Unused for pointer linked items.
+ * @param item Menu item.
+ * @return menu_callback_t Callback or NULL.
+ */
+static menu_callback_t item_callback(menu_source_t src, menu_ref_t item)
+{
+    (void)src;
+    return item->callback;
+}
+
+/**
+ * @brief Check if the menu root does not contain any item.
+ *
+ * @param root_menu Pointer to the root menu.
+ * @return true if root_menu is NULL.
+ */
+static bool is_menu_root_empty(const menu_root_t *root_menu)
+{
+    return (root_menu == NULL);
+}
+
+/**
+ * @brief Check if an item reference points into the item storage.
+ *
+ * @param src Unused for pointer linked items.
+ * @param item Menu item (not MENU_NO_NODE).
+ * @return true, pointers can not be range checked.
+ */
+static bool is_item_in_source(menu_source_t src, menu_ref_t item)
+{
+    (void)src;
+    (void)item;
+    return true;
+}
+#else
+/**
+ * @brief Next item on the same level.
+ *
+ * @param src Menu table.
+ * @param item Node index.
+ * @return menu_ref_t Next node index or MENU_NO_NODE.
+ */
+static menu_ref_t item_next(menu_source_t src, menu_ref_t item)
+{
+    return src->nodes[item].next;
+}
+
+/**
+ * @brief Previous item on the same level.
+ *
+ * @param src Menu table.
+ * @param item Node index.
+ * @return menu_ref_t Previous node index or MENU_NO_NODE.
+ */
+static menu_ref_t item_prev(menu_source_t src, menu_ref_t item)
+{
+    return src->nodes[item].prev;
+}
+
+/**
+ * @brief First item of the submenu.
+ *
+ * @param src Menu table.
+ * @param item Node index.
+ * @return menu_ref_t Child node index or MENU_NO_NODE.
+ */
+static menu_ref_t item_child(menu_source_t src, menu_ref_t item)
+{
+    return src->nodes[item].child;
+}
+
+/**
+ * @brief Parent item.
+ *
+ * @param src Menu table.
+ * @param item Node index.
+ * @return menu_ref_t Parent node index or MENU_NO_NODE on the top level.
+ */
+static menu_ref_t item_parent(menu_source_t src, menu_ref_t item)
+{
+    return src->nodes[item].parent;
+}
+
+/**
+ * @brief Name of the item.
+ *
+ * @param src Menu table.
+ * @param item Node index.
+ * @return const char* Item name stored at name_offset in the names blob.
+ */
+static const char *item_name(menu_source_t src, menu_ref_t item)
+{
+    return &src->names[src->nodes[item].name_offset];
+}
+
+/**
+ * @brief Callback of the item.
+ *
+ * @param src Menu table.
+ * @param item Node index.
+ * @return menu_callback_t Callback or NULL when callback_id is MENU_NO_CALLBACK.
+ */
+static menu_callback_t item_callback(menu_source_t src, menu_ref_t item)
+{
+    menu_callback_t callback = NULL;
+    uint8_t callback_id = src->nodes[item].callback_id;
+
+    if ((callback_id != MENU_NO_CALLBACK) && (src->callbacks != NULL))
+    {
+        callback = src->callbacks[callback_id];
+    }
+
+    return callback;
+}
+
+/**
+ * @brief Check if the menu table does not contain any item.
+ *
+ * @param root_menu Pointer to the menu table.
+ * @return true if the table, its nodes or names are missing or node_count is 0.
+ */
+static bool is_menu_root_empty(const menu_root_t *root_menu)
+{
+    return (root_menu == NULL) ||
+           (root_menu->nodes == NULL) ||
+           (root_menu->names == NULL) ||
+           (root_menu->node_count == 0U);
+}
+
+/**
+ * @brief Check if a node index points into the menu table.
+ *
+ * @param src Menu table.
+ * @param item Node index (not MENU_NO_NODE).
+ * @return true if the index is lower than node_count.
+ */
+static bool is_item_in_source(menu_source_t src, menu_ref_t item)
+{
+    return (item < src->node_count);
+}
+#endif /* MENU_USE_COMPACT_TABLE */
+
+/**
+ * @brief Check the links of an item reached during the tree validation.
+ *
+ * @param src Menu item storage.
+ * @param item Reached item.
+ * @param prev Item it was reached from on the same level (MENU_NO_NODE for the first item).
+ * @param parent Item of the level above (MENU_NO_NODE on the top level).
+ * @return true if the item exists and its prev and parent links lead back.
+ */
+static bool are_item_links_valid(menu_source_t src, menu_ref_t item, menu_ref_t prev, menu_ref_t parent)
+{
+#ifdef MENU_USE_SLIM_NODES
+    (void)prev; /* Slim nodes have no links back, next cycles are bounded by the walk */
+    (void)parent;
+    return is_item_in_source(src, item);
+#else
+    return is_item_in_source(src, item) &&
+           (item_prev(src, item) == prev) &&
+           (item_parent(src, item) == parent);
+#endif
+}
+
+/**
+ * @brief Validate the whole menu tree without recursion.
+ *
+ * Walks all levels depth first, keeping only the path to the visited item
+ * (at most MAX_MENU_DEPTH items). Every reached item must link back to the
+ * item it was reached from, so a tree passing the walk has no cycles and the
+ * walk ends after visiting each item once.
+ *
+ * @param src Menu item storage.
+ * @param root First top level item.
+ * @return menu_status_t MENU_OK, MENU_ERR_MENU_TOO_DEEP or MENU_ERR_MALFORMED_MENU.
+ */
+static menu_status_t validate_menu_tree(menu_source_t src, menu_ref_t root)
+{
+    menu_tree_walk_t walk;
+    menu_status_t status = MENU_ERR_MALFORMED_MENU;
+
+    walk.src = src;
+    walk.path[0] = root;
+    walk.level = 0U;
+    walk.finished = false;
+#ifdef MENU_USE_SLIM_NODES
+    walk.items_qty[0] = 1U;
+#endif
+
+    if (are_item_links_valid(src, root, MENU_NO_NODE, MENU_NO_NODE))
+    {
+        status = MENU_OK;
+        while ((status == MENU_OK) && !walk.finished)
+        {
+            status = walk_menu_tree_step(&walk);
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief Move the tree walk to the next item in depth first order.
+ *
+ * @param walk Tree walk state.
+ * @return menu_status_t MENU_OK, MENU_ERR_MENU_TOO_DEEP or MENU_ERR_MALFORMED_MENU.
+ */
+static menu_status_t walk_menu_tree_step(menu_tree_walk_t *walk)
+{
+    menu_ref_t item = walk->path[walk->level];
+    menu_ref_t child = item_child(walk->src, item);
+    menu_status_t status;
+
+    if (is_list_item_with_submenu(item, child))
+    {
+        status = MENU_ERR_MALFORMED_MENU;
+    }
+    else if (child != MENU_NO_NODE)
+    {
+        status = walk_into_child(walk, child);
+    }
+#ifdef MENU_USE_VIRTUAL_LISTS
+    else if ((item->list != NULL) && ((walk->level + 1U) >= MAX_MENU_DEPTH))
+    {
+        status = MENU_ERR_MENU_TOO_DEEP; /* virtual list entries form one more level */
+    }
+#endif
+    else
+    {
+        status = walk_to_next_item(walk);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Check if an item has both a virtual list and a submenu.
+ *
+ * The list is opened instead of the submenu, so the child subtree would
+ * never be reached.
+ *
+ * @param item Visited item.
+ * @param child First submenu item of the visited item.
+ * @return true for a virtual list item with a child.
+ */
+static bool is_list_item_with_submenu(menu_ref_t item, menu_ref_t child)
+{
+#ifdef MENU_USE_VIRTUAL_LISTS
+    return (item->list != NULL) && (child != MENU_NO_NODE);
+#else
+    (void)item;
+    (void)child;
+    return false;
+#endif
+}
+
+/**
+ * @brief Descend the tree walk to the first item of a submenu.
+ *
+ * @param walk Tree walk state.
+ * @param child First submenu item of the visited item.
+ * @return menu_status_t MENU_OK, MENU_ERR_MENU_TOO_DEEP or MENU_ERR_MALFORMED_MENU.
+ */
+static menu_status_t walk_into_child(menu_tree_walk_t *walk, menu_ref_t child)
+{
+    menu_status_t status = MENU_OK;
+
+    if ((walk->level + 1U) >= MAX_MENU_DEPTH)
+    {
+        status = MENU_ERR_MENU_TOO_DEEP;
+    }
+    else if (!are_item_links_valid(walk->src, child, MENU_NO_NODE, walk->path[walk->level]))
+    {
+        status = MENU_ERR_MALFORMED_MENU;
+    }
+    else
+    {
+        walk->level++;
+        walk->path[walk->level] = child;
+#ifdef MENU_USE_SLIM_NODES
+        walk->items_qty[walk->level] = 1U;
+#endif
+    }
+
+    return status;
+}
+
+/**
+ * @brief Move the tree walk to the next item on the same or a higher level.
+ *
+ * Sets walk->finished when there is no next item on any level of the path.
+ *
+ * @param walk Tree walk state.
+ * @return menu_status_t MENU_OK or MENU_ERR_MALFORMED_MENU.
+ */
+static menu_status_t walk_to_next_item(menu_tree_walk_t *walk)
+{
+    menu_status_t status = MENU_OK;
+    bool moved = false;
+
+    while (!moved && !walk->finished)
+    {
+        menu_ref_t item = walk->path[walk->level];
+        menu_ref_t next = item_next(walk->src, item);
+
+        if (next != MENU_NO_NODE)
+        {
+            menu_ref_t parent = (walk->level > 0U) ? walk->path[walk->level - 1U] : MENU_NO_NODE;
+
+            if (!are_item_links_valid(walk->src, next, item, parent) || !count_level_item(walk))
+            {
+                status = MENU_ERR_MALFORMED_MENU;
+            }
+            walk->path[walk->level] = next;
+            moved = true;
+        }
+        else if (walk->level > 0U)
+        {
+            walk->level--;
+        }
+        else
+        {
+            walk->finished = true;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief Count an item reached through a next link on the current walk level.
+ *
+ * Items are indexed with 16 bits on each level, so a level with more items
+ * is malformed. With slim nodes this also ends the walk of a next link cycle,
+ * which is otherwise detected by the prev links.
+ *
+ * @param walk Tree walk state.
+ * @return true if the level still has less than UINT16_MAX items.
+ */
+static bool count_level_item(menu_tree_walk_t *walk)
+{
+#ifdef MENU_USE_SLIM_NODES
+    bool counted = (walk->items_qty[walk->level] < UINT16_MAX);
+
+    walk->items_qty[walk->level]++;
+
+    return counted;
+#else
+    (void)walk;
+    return true;
+#endif
+}
+
+/**
+ * @brief Check if a menu root already passed the tree validation in the context.
+ *
+ * @param ctx Menu context.
+ * @param root_menu Pointer to the root menu.
+ * @return true if the root is remembered as validated or is a compact table checked at compile time.
+ */
+static bool is_menu_validated(const menu_ctx_t *ctx, const menu_root_t *root_menu)
+{
+#ifdef MENU_USE_COMPACT_TABLE
+    /* tables emitted by MENU_TABLE_DEFINE are checked at compile time */
+    bool validated = (root_menu->checked_depth != 0U) && (root_menu->checked_depth <= MAX_MENU_DEPTH);
+#else
+    bool validated = false;
+#endif
+
+    for (uint8_t i = 0U; (i < MENU_VALIDATED_MENUS_QTY) && !validated; i++)
+    {
+        validated = (ctx->validated_menus[i] == root_menu);
+    }
+
+    return validated;
+}
+
+/**
+ * @brief Remember a validated menu root, replacing the oldest one when all slots are used.
+ *
+ * @param ctx Menu context.
+ * @param root_menu Pointer to the root menu.
+ */
+static void remember_validated_menu(menu_ctx_t *ctx, menu_root_t *root_menu)
+{
+    ctx->validated_menus[ctx->validated_menus_next] = root_menu;
+    ctx->validated_menus_next = (uint8_t)((ctx->validated_menus_next + 1U) % MENU_VALIDATED_MENUS_QTY);
+}
+
+/**
+ * @brief Validate menu view configuration.
+ *
+ * Ensures context is initialized, the menu root is valid, the menu depth
+ * does not exceed the maximum allowed and the item links are consistent.
+ * The tree is walked only for roots not validated before in the context.
+ *
+ * @param ctx Menu context.
+ * @param root_menu Pointer to the root menu.
+ * @return menu_status_t Validation result.
+ */
+static menu_status_t validate_menu_view(menu_ctx_t *ctx, menu_root_t *root_menu)
+{
+    menu_status_t status = MENU_OK;
+
+    if (ctx == NULL)
+    {
+        status = MENU_ERR_NO_CONTEXT;
+    }
+    else if (!ctx->initialized)
+    {
+        status = MENU_ERR_NOT_INITIALIZED;
+    }
+    else if (is_menu_root_empty(root_menu))
+    {
+        status = MENU_ERR_NO_MENU;
+    }
+    else if (!is_menu_validated(ctx, root_menu))
+    {
+        status = validate_menu_tree(MENU_ROOT_SOURCE(root_menu), MENU_ROOT_ITEM(root_menu));
+        if (status == MENU_OK)
+        {
+            remember_validated_menu(ctx, root_menu);
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief Initialize menu view internal state.
+ *
+ * Sets current menu, first item, cursor positions, and top-level exit callback.
+ *
+ * @param ctx Menu context
+ * @param root_menu Root menu pointer
+ * @param menu_exit_cb Top-level exit callback
+ * @param custom_menu_header Optional custom header
+ */
+static void initialize_menu_view_state(menu_ctx_t *ctx, menu_root_t *root_menu, menu_exit_cb_t menu_exit_cb, const char *custom_menu_header)
+{
+#ifdef MENU_USE_COMPACT_TABLE
+    ctx->menu_table = root_menu;
+#endif
+    ctx->current_menu_pointer = MENU_ROOT_ITEM(root_menu);
+    ctx->menu_level = 0U;
+    ctx->cursor_selection_menu_index[0] = 0U;
+    ctx->cursor_row_position[0] = 0U;
+    ctx->window_top_menu[0] = ctx->current_menu_pointer;
+#ifdef MENU_USE_SLIM_NODES
+    ctx->root_menu_item = ctx->current_menu_pointer;
+#endif
+    ctx->menu_top_level_exit_cb = menu_exit_cb;
+    ctx->custom_header = custom_menu_header;
+    ctx->event_tail = ctx->event_head;
+#ifdef MENU_USE_VIRTUAL_LISTS
+    ctx->active_list = NULL;
+#endif
+    update_header_geometry(ctx);
+
+    menu_ctx_update_screen_view(ctx);
+}
+
+/**
+ * @brief Bring the screen in sync with the current navigation state.
+ *
+ * Rewrites only the cursor marker cells when possible, otherwise
+ * performs a full redraw. Remembers what was drawn for the next call.
+ *
+ * @param ctx Menu context.
+ */
+static void render_menu_view(menu_ctx_t *ctx)
+{
+    MENU_TRACE_BEGIN(ctx, MENU_TRACE_UPDATE_VIEW);
+    if (is_cursor_only_update_possible(ctx))
+    {
+        update_cursor_marker(ctx);
+    }
+    else
+    {
+        redraw_menu_view(ctx);
+    }
+
+    ctx->drawn_menu_level = ctx->menu_level;
+    ctx->drawn_window_top_index = get_window_top_index(ctx);
+    ctx->drawn_window_top = get_window_top_item(ctx);
+    ctx->drawn_cursor_row = ctx->cursor_row_position[ctx->menu_level];
+    ctx->screen_view_valid = true;
+    MENU_TRACE_END(ctx, MENU_TRACE_UPDATE_VIEW);
+}
+
+/**
+ * @brief Selection index of the first visible item on the current level.
+ *
+ * @param ctx Menu context.
+ * @return uint16_t Index of the window top item.
+ */
+static uint16_t get_window_top_index(const menu_ctx_t *ctx)
+{
+    return ctx->cursor_selection_menu_index[ctx->menu_level] - ctx->cursor_row_position[ctx->menu_level];
+}
+
+/**
+ * @brief First visible item on the current level.
+ *
+ * Two submenus at the same depth can have the same level and window top
+ * index, the item identifies which one is shown. On a virtual list level
+ * the item that owns the list is returned.
+ *
+ * @param ctx Menu context.
+ * @return menu_ref_t Window top item or list owner.
+ */
+static menu_ref_t get_window_top_item(const menu_ctx_t *ctx)
+{
+    menu_ref_t item = ctx->window_top_menu[ctx->menu_level];
+
+#ifdef MENU_USE_VIRTUAL_LISTS
+    if (ctx->active_list != NULL)
+    {
+        item = ctx->current_menu_pointer;
+    }
+#endif
+
+    return item;
+}
+
+/**
+ * @brief Check if the last drawn view differs from the current one only by cursor row.
+ *
+ * @param ctx Menu context.
+ * @return true in incremental mode when level, submenu and visible window did not change.
+ */
+static bool is_cursor_only_update_possible(const menu_ctx_t *ctx)
+{
+    return (ctx->render_mode == MENU_RENDER_INCREMENTAL) &&
+           !is_shadow_buffer_in_use(ctx) &&
+           ctx->screen_view_valid &&
+           (ctx->drawn_menu_level == ctx->menu_level) &&
+           (ctx->drawn_window_top_index == get_window_top_index(ctx)) &&
+           (ctx->drawn_window_top == get_window_top_item(ctx));
+}
+
+/**
+ * @brief Move the '>' marker from the previously drawn row to the current one.
+ *
+ * @param ctx Menu context.
+ */
+static void update_cursor_marker(const menu_ctx_t *ctx)
+{
+    uint8_t cursor_row = ctx->cursor_row_position[ctx->menu_level];
+
+    if (cursor_row != ctx->drawn_cursor_row)
+    {
+        MENU_TRACE_DRIVER(MENU_TRACE_DRV_CURSOR_POSITION, ctx->drawn_cursor_row + MENU_VIEW_FIRST_ROW, CURSOR_COLUMN_POSITION);
+        DRV_CURSOR_POSITION(ctx, ctx->drawn_cursor_row + MENU_VIEW_FIRST_ROW, CURSOR_COLUMN_POSITION);
+        MENU_TRACE_DRIVER(MENU_TRACE_DRV_PRINT_CHAR, ctx->drawn_cursor_row + MENU_VIEW_FIRST_ROW, CURSOR_COLUMN_POSITION);
+        DRV_PRINT_CHAR(ctx, ' ');
+        MENU_TRACE_DRIVER(MENU_TRACE_DRV_CURSOR_POSITION, cursor_row + MENU_VIEW_FIRST_ROW, CURSOR_COLUMN_POSITION);
+        DRV_CURSOR_POSITION(ctx, cursor_row + MENU_VIEW_FIRST_ROW, CURSOR_COLUMN_POSITION);
+        MENU_TRACE_DRIVER(MENU_TRACE_DRV_PRINT_CHAR, cursor_row + MENU_VIEW_FIRST_ROW, CURSOR_COLUMN_POSITION);
+        DRV_PRINT_CHAR(ctx, '>');
+    }
+}
+
+/**
+ * @brief Redraw header, clear menu area and print all visible items with cursor.
+ *
+ * Composes rows in a line buffer when the driver provides write_row() or
+ * the shadow buffer is used.
+ *
+ * @param ctx Menu context.
+ */
+static void redraw_menu_view(menu_ctx_t *ctx)
+{
+    if (is_row_compose_available(ctx))
+    {
+        write_menu_view_rows(ctx);
+    }
+    else
+    {
+        display_menu_header(ctx);
+        clear_current_menu_view_with_cursor(ctx);
+        update_current_menu_view_with_cursor(ctx);
+    }
+}
+
+/**
+ * @brief Check if rows can be composed in the line buffer.
+ *
+ * @param ctx Menu context.
+ * @return true if the screen fits in the shadow buffer (MENU_USE_SHADOW_BUFFER builds)
+ * or write_row is provided and a row fits in the line buffer.
+ */
+static bool is_row_compose_available(const menu_ctx_t *ctx)
+{
+#ifdef MENU_USE_SHADOW_BUFFER
+    return (ctx->screen_lines <= MENU_MAX_SCREEN_LINES) &&
+           (ctx->chars_per_line <= MENU_MAX_CHARS_PER_LINE);
+#else
+    return DRV_HAS_WRITE_ROW(ctx) &&
+           (ctx->chars_per_line <= MENU_MAX_CHARS_PER_LINE);
+#endif
+}
+
+/**
+ * @brief Check if the view is drawn through the shadow buffer.
+ *
+ * Diffing against the shadow buffer already limits the output to changed cells,
+ * so the incremental cursor-only update is not used in that case.
+ *
+ * @param ctx Menu context.
+ * @return true in MENU_USE_SHADOW_BUFFER builds when the screen fits in the buffer.
+ */
+static bool is_shadow_buffer_in_use(const menu_ctx_t *ctx)
+{
+#ifdef MENU_USE_SHADOW_BUFFER
+    return is_row_compose_available(ctx);
+#else
+    (void)ctx;
+    return false;
+#endif
+}
+
+/**
+ * @brief Compose every row of the view in a line buffer and emit it.
+ *
+ * @param ctx Menu context.
+ */
+static void write_menu_view_rows(menu_ctx_t *ctx)
+{
+    char row_buf[MENU_MAX_CHARS_PER_LINE + 1U]; /* +1 for span terminator */
+    menu_view_iter_t iter;
+
+#ifdef MENU_USE_SHADOW_BUFFER
+    if (!ctx->shadow_buffer_valid)
+    {
+        /* Content of the display is unknown, NUL never matches a composed character */
+        memset(ctx->shadow_buffer, '\0', sizeof(ctx->shadow_buffer));
+        ctx->shadow_buffer_valid = true;
+    }
+#endif
+
+    compose_header_row(ctx, row_buf);
+    emit_menu_view_row(ctx, FIRST_ROW, row_buf);
+
+    start_view_iteration(ctx, &iter);
+    for (uint8_t row = MENU_VIEW_FIRST_ROW; row < ctx->screen_lines; row++)
+    {
+        compose_menu_item_row(ctx, row_buf, row, get_next_view_row_name(ctx, &iter));
+        emit_menu_view_row(ctx, row, row_buf);
+    }
+}
+
+/**
+ * @brief Send a composed row to the display.
+ *
+ * Without the shadow buffer the row is written with one write_row() call.
+ * With the shadow buffer unchanged rows are skipped, changed rows are written
+ * with write_row() if provided, otherwise each changed span is written with
+ * cursor_position() + print_string().
+ *
+ * @param ctx Menu context.
+ * @param row Screen row.
+ * @param row_buf Composed row (chars_per_line characters + 1 spare byte).
+ */
+static void emit_menu_view_row(menu_ctx_t *ctx, uint8_t row, char *row_buf)
+{
+#ifdef MENU_USE_SHADOW_BUFFER
+    if (memcmp(ctx->shadow_buffer[row], row_buf, ctx->chars_per_line) != 0)
+    {
+        if (DRV_HAS_WRITE_ROW(ctx))
+        {
+            MENU_TRACE_DRIVER(MENU_TRACE_DRV_WRITE_ROW, row, ctx->chars_per_line);
+            DRV_WRITE_ROW(ctx, row, row_buf, ctx->chars_per_line);
+        }
+        else
+        {
+            write_changed_spans(ctx, row, row_buf);
+        }
+        memcpy(ctx->shadow_buffer[row], row_buf, ctx->chars_per_line);
+    }
+#else
+    MENU_TRACE_DRIVER(MENU_TRACE_DRV_WRITE_ROW, row, ctx->chars_per_line);
+    DRV_WRITE_ROW(ctx, row, row_buf, ctx->chars_per_line);
+#endif
+}
+
+#ifdef MENU_USE_SHADOW_BUFFER
+/**
+ * @brief Write every contiguous span of a row that differs from the shadow buffer.
+ *
+ * @param ctx Menu context.
+ * @param row Screen row.
+ * @param row_buf Composed row (chars_per_line characters + 1 spare byte).
+ */
+static void write_changed_spans(const menu_ctx_t *ctx, uint8_t row, char *row_buf)
+{
+    uint8_t column = 0U;
+
+    while (column < ctx->chars_per_line)
+    {
+        if (row_buf[column] == ctx->shadow_buffer[row][column])
+        {
+            column++;
+        }
+        else
+        {
+            uint8_t span_end = find_span_end(ctx, row, row_buf, column);
+            char char_after_span = row_buf[span_end];
+
+            /* Terminate the span in place, print it and restore the buffer */
+            row_buf[span_end] = '\0';
+            MENU_TRACE_DRIVER(MENU_TRACE_DRV_CURSOR_POSITION, row, column);
+            DRV_CURSOR_POSITION(ctx, row, column);
+            MENU_TRACE_DRIVER(MENU_TRACE_DRV_PRINT_STRING, row, column);
+            DRV_PRINT_STRING(ctx, &row_buf[column]);
+            row_buf[span_end] = char_after_span;
+            column = span_end;
+        }
+    }
+}
+
+/**
+ * @brief Find the end of a changed span.
+ *
+ * @param ctx Menu context.
+ * @param row Screen row.
+ * @param row_buf Composed row.
+ * @param column First changed column.
+ * @return uint8_t First column after the span that matches the shadow buffer (or chars_per_line).
+ */
+static uint8_t find_span_end(const menu_ctx_t *ctx, uint8_t row, const char *row_buf, uint8_t column)
+{
+    while ((column < ctx->chars_per_line) && (row_buf[column] != ctx->shadow_buffer[row][column]))
+    {
+        column++;
+    }
+
+    return column;
+}
+#endif /* MENU_USE_SHADOW_BUFFER */
+
+/**
+ * @brief Compose the header row: dashes with the cached main or submenu title.
+ *
+ * @param ctx Menu context.
+ * @param row_buf Line buffer of chars_per_line characters.
+ */
+static void compose_header_row(const menu_ctx_t *ctx, char *row_buf)
+{
+    uint8_t padding_qty = ctx->header_padded ? 1U : 0U;
+    uint8_t column = ctx->header_column;
+
+    memset(row_buf, '-', ctx->chars_per_line);
+    column = put_spaces_to_row(ctx, row_buf, column, padding_qty);
+    column = copy_text_to_row(ctx, row_buf, column, ctx->header_text);
+    (void)put_spaces_to_row(ctx, row_buf, column, padding_qty);
+}
+
+/**
+ * @brief Start reading the names shown in the rows of the menu view.
+ *
+ * @param ctx Menu context.
+ * @param iter Iterator to initialize.
+ */
+static void start_view_iteration(const menu_ctx_t *ctx, menu_view_iter_t *iter)
+{
+    iter->item = ctx->window_top_menu[ctx->menu_level];
+#ifdef MENU_USE_VIRTUAL_LISTS
+    iter->list_index = get_window_top_index(ctx);
+    iter->list_count = (ctx->active_list != NULL) ? ctx->active_list->count() : 0U;
+#endif
+}
+
+/**
+ * @brief Get the name shown in the next row of the menu view.
+ *
+ * Regular items are read from the window top onwards. On a virtual list
+ * level the provider is asked for the names of the visible entries only.
+ *
+ * @param ctx Menu context.
+ * @param iter View iterator.
+ * @return const char* Printable name, or NULL past the last item.
+ */
+static const char *get_next_view_row_name(const menu_ctx_t *ctx, menu_view_iter_t *iter)
+{
+    const char *name = NULL;
+
+    (void)ctx; /* MENU_SOURCE() does not use it with pointer linked items */
+    if (iter->item != MENU_NO_NODE)
+    {
+        name = get_printable_name(item_name(MENU_SOURCE(ctx), iter->item));
+        iter->item = item_next(MENU_SOURCE(ctx), iter->item);
+    }
+#ifdef MENU_USE_VIRTUAL_LISTS
+    else if (iter->list_index < iter->list_count)
+    {
+        iter->name_buf[0] = '\0';
+        ctx->active_list->get_name(iter->list_index, iter->name_buf, (uint8_t)sizeof(iter->name_buf));
+        iter->name_buf[sizeof(iter->name_buf) - 1U] = '\0';
+        name = iter->name_buf;
+        iter->list_index++;
+    }
+#endif
+
+    return name;
+}
+
+/**
+ * @brief Compose a menu view row: cursor marker and item name.
+ *
+ * @param ctx Menu context.
+ * @param row_buf Line buffer of chars_per_line characters.
+ * @param row Screen row being composed.
+ * @param name Name shown in the row or NULL for an empty row.
+ */
+static void compose_menu_item_row(const menu_ctx_t *ctx, char *row_buf, uint8_t row, const char *name)
+{
+    memset(row_buf, ' ', ctx->chars_per_line);
+
+    if (row == (ctx->cursor_row_position[ctx->menu_level] + MENU_VIEW_FIRST_ROW))
+    {
+        row_buf[CURSOR_COLUMN_POSITION] = '>';
+    }
+    if (name != NULL)
+    {
+        (void)copy_text_to_row(ctx, row_buf, STRING_START_POSITION, name);
+    }
+}
+
+/**
+ * @brief Copy text into the line buffer, clipped at the screen width.
+ *
+ * @param ctx Menu context.
+ * @param row_buf Line buffer of chars_per_line characters.
+ * @param column First column to write.
+ * @param text Null-terminated text.
+ * @return uint8_t Column following the last copied character.
+ */
+static uint8_t copy_text_to_row(const menu_ctx_t *ctx, char *row_buf, uint8_t column, const char *text)
+{
+    char c = MENU_TEXT_CHAR(text);
+
+    while ((column < ctx->chars_per_line) && (c != '\0'))
+    {
+        row_buf[column] = c;
+        column++;
+        text++;
+        c = MENU_TEXT_CHAR(text);
+    }
+
+    return column;
+}
+
+/**
+ * @brief Put spaces into the line buffer, clipped at the screen width.
+ *
+ * @param ctx Menu context.
+ * @param row_buf Line buffer of chars_per_line characters.
+ * @param column First column to write.
+ * @param qty Number of spaces.
+ * @return uint8_t Column following the last space.
+ */
+static uint8_t put_spaces_to_row(const menu_ctx_t *ctx, char *row_buf, uint8_t column, uint8_t qty)
+{
+    for (uint8_t i = 0U; (i < qty) && (column < ctx->chars_per_line); i++)
+    {
+        row_buf[column] = ' ';
+        column++;
+    }
+
+    return column;
+}
+
+/**
+ * @brief Cache the header title and its column for the current menu level.
+ *
+ * Called on level changes only, so redraws do not recompute string lengths.
+ * The top level uses the custom header centered on the screen (or the default
+ * header at the default column), a submenu uses the parent name centered with
+ * one space of padding on both sides (a virtual list uses the name of the
+ * item that opened it).
+ *
+ * @param ctx Menu context.
+ */
+static void update_header_geometry(menu_ctx_t *ctx)
+{
+    menu_ref_t parent;
+
+#ifdef MENU_USE_VIRTUAL_LISTS
+    if (ctx->active_list != NULL)
+    {
+        /* A virtual list is titled with the item that opened it */
+        parent = ctx->current_menu_pointer;
+    }
+    else
+#endif
+    {
+        parent = get_parent_item(ctx);
+    }
+    ctx->header_padded = (parent != MENU_NO_NODE);
+
+    if (ctx->header_padded)
+    {
+        ctx->header_text = item_name(MENU_SOURCE(ctx), parent);
+        ctx->header_column = get_centered_column(ctx, get_text_length(ctx->header_text) + ADDITIONAL_SPACE_CHAR_QTY);
+    }
+    else if (ctx->custom_header != NULL)
+    {
+        ctx->header_text = ctx->custom_header;
+        ctx->header_column = get_centered_column(ctx, get_text_length(ctx->custom_header));
+    }
+    else
+    {
+        ctx->header_text = default_header;
+        ctx->header_column = DEFAULT_MENU_HEADER_COLUMN;
+    }
+}
+
+/**
+ * @brief Length of a name or header, read through MENU_TEXT_CHAR().
+ *
+ * @param text Null-terminated text.
+ * @return uint8_t Number of characters, clipped at 255.
+ */
+static uint8_t get_text_length(const char *text)
+{
+    uint8_t length = 0U;
+
+    while ((length < UINT8_MAX) && (MENU_TEXT_CHAR(&text[length]) != '\0'))
+    {
+        length++;
+    }
+
+    return length;
+}
+
+/**
+ * @brief Column that centers text of the given length on the screen.
+ *
+ * @param ctx Menu context.
+ * @param text_length Length of the text.
+ * @return uint8_t Start column, FIRST_COLUMN if the text does not fit.
+ */
+static uint8_t get_centered_column(const menu_ctx_t *ctx, uint8_t text_length)
+{
+    uint8_t column = FIRST_COLUMN;
+
+    if (ctx->chars_per_line > text_length)
+    {
+        column = (ctx->chars_per_line - text_length) / 2U;
+    }
+
+    return column;
+}
+
+/**
+ * @brief Get the text printed for a menu item name.
+ *
+ * @param name Menu item name.
+ * @return const char* name, or "NO NAME" if name is NULL.
+ */
+static const char *get_printable_name(const char *name)
+{
+    const char *text_to_print = name;
+    if (text_to_print == NULL)
+    {
+        text_to_print = no_name_text;
+    }
+
+    return text_to_print;
+}
+
+/**
+ * @brief Display appropriate menu header (main or submenu).
+ *
+ * The dashes and the title are composed in a line buffer and printed with
+ * one print_string() call, so the title cells are not drawn twice.
+ *
+ * @param ctx Menu context.
+ */
+static void display_menu_header(const menu_ctx_t *ctx)
+{
+    if (ctx->chars_per_line <= MENU_MAX_CHARS_PER_LINE)
+    {
+        char row_buf[MENU_MAX_CHARS_PER_LINE + 1U];
+
+        compose_header_row(ctx, row_buf);
+        row_buf[ctx->chars_per_line] = '\0';
+        MENU_TRACE_DRIVER(MENU_TRACE_DRV_CURSOR_POSITION, FIRST_ROW, FIRST_COLUMN);
+        DRV_CURSOR_POSITION(ctx, FIRST_ROW, FIRST_COLUMN);
+        MENU_TRACE_DRIVER(MENU_TRACE_DRV_PRINT_STRING, FIRST_ROW, FIRST_COLUMN);
+        DRV_PRINT_STRING(ctx, row_buf);
+    }
+    else
+    {
+        fill_header_with_dashes(ctx);
+        display_header_title(ctx);
+    }
+}
+
+/**
+ * @brief Display the cached header title over the dashes.
+ *
+ * Used for screens wider than the line buffer.
+ *
+ * @param ctx Menu context.
+ */
+static void display_header_title(const menu_ctx_t *ctx)
+{
+    MENU_TRACE_DRIVER(MENU_TRACE_DRV_CURSOR_POSITION, FIRST_ROW, ctx->header_column);
+    DRV_CURSOR_POSITION(ctx, FIRST_ROW, ctx->header_column);
+    if (ctx->header_padded)
+    {
+        MENU_TRACE_DRIVER(MENU_TRACE_DRV_PRINT_CHAR, FIRST_ROW, ctx->header_column);
+        DRV_PRINT_CHAR(ctx, ' ');
+    }
+    print_text(ctx, FIRST_ROW, ctx->header_column, ctx->header_text);
+    if (ctx->header_padded)
+    {
+        MENU_TRACE_DRIVER(MENU_TRACE_DRV_PRINT_CHAR, FIRST_ROW, ctx->header_column);
+        DRV_PRINT_CHAR(ctx, ' ');
+    }
+}
+
+/**
+ * @brief Fill header row with dash characters.
+ *
+ * @param ctx Menu context.
+ */
+static void fill_header_with_dashes(const menu_ctx_t *ctx)
+{
+    if (DRV_HAS_FILL(ctx))
+    {
+        MENU_TRACE_DRIVER(MENU_TRACE_DRV_FILL, FIRST_ROW, ctx->chars_per_line);
+        DRV_FILL(ctx, FIRST_ROW, FIRST_COLUMN, '-', ctx->chars_per_line);
+    }
+    else
+    {
+        MENU_TRACE_DRIVER(MENU_TRACE_DRV_CURSOR_POSITION, FIRST_ROW, FIRST_COLUMN);
+        DRV_CURSOR_POSITION(ctx, FIRST_ROW, FIRST_COLUMN);
+        for (uint8_t i = 0U; i < ctx->chars_per_line; i++)
+        {
+            MENU_TRACE_DRIVER(MENU_TRACE_DRV_PRINT_CHAR, FIRST_ROW, FIRST_COLUMN);
+            DRV_PRINT_CHAR(ctx, '-');
+        }
+    }
+}
+
+/**
+ * @brief Clear the menu view area on the screen.
+ *
+ * @param ctx Menu context.
+ */
+static void clear_current_menu_view_with_cursor(const menu_ctx_t *ctx)
+{
+    for (uint8_t i = MENU_VIEW_FIRST_ROW; i < ctx->screen_lines; i++)
+    {
+        if (DRV_HAS_FILL(ctx))
+        {
+            MENU_TRACE_DRIVER(MENU_TRACE_DRV_FILL, i, ctx->chars_per_line);
+            DRV_FILL(ctx, i, FIRST_COLUMN, ' ', ctx->chars_per_line);
+        }
+        else
+        {
+            MENU_TRACE_DRIVER(MENU_TRACE_DRV_CURSOR_POSITION, i, FIRST_COLUMN);
+            DRV_CURSOR_POSITION(ctx, i, FIRST_COLUMN);
+            for (uint8_t j = 0U; j < ctx->chars_per_line; j++)
+            {
+                MENU_TRACE_DRIVER(MENU_TRACE_DRV_PRINT_CHAR, i, FIRST_COLUMN);
+                DRV_PRINT_CHAR(ctx, ' ');
+            }
+        }
+    }
+}
+
+/**
+ * @brief Render visible menu items with cursor.
+ *
+ * Starts from the window top cached for the current level, so the cost does
+ * not depend on the position of the cursor in the list.
+ *
+ * @param ctx Menu context.
+ */
+static void update_current_menu_view_with_cursor(const menu_ctx_t *ctx)
+{
+    menu_view_iter_t iter;
+
+    start_view_iteration(ctx, &iter);
+    for (uint8_t row = MENU_VIEW_FIRST_ROW; row < ctx->screen_lines; row++)
+    {
+        const char *name;
+
+        display_cursor_marker_if_needed(ctx, row);
+
+        name = get_next_view_row_name(ctx, &iter);
+        if (name == NULL)
+        {
             // Null -> no more items to print on lcd
             break;
         }
 
-        display_menu_item_name(row, menu_item_2_print->name);
-        menu_item_2_print = menu_item_2_print->next;
+        display_menu_item_name(ctx, row, name);
     }
 }
 
 /**
  * @brief Display '>' marker if current row is selected.
  *
+ * @param ctx Menu context.
  * @param row Screen row to draw cursor marker
  */
-static void display_cursor_marker_if_needed(uint8_t row)
+static void display_cursor_marker_if_needed(const menu_ctx_t *ctx, uint8_t row)
 {
-    DISPLAY->cursor_position(row, CURSOR_COLUMN_POSITION);
-    if (row == (cursor_row_position[menu_level] + MENU_VIEW_FIRST_ROW))
-        DISPLAY->print_char('>');
+    MENU_TRACE_DRIVER(MENU_TRACE_DRV_CURSOR_POSITION, row, CURSOR_COLUMN_POSITION);
+    DRV_CURSOR_POSITION(ctx, row, CURSOR_COLUMN_POSITION);
+    if (row == (ctx->cursor_row_position[ctx->menu_level] + MENU_VIEW_FIRST_ROW))
+    {
+        MENU_TRACE_DRIVER(MENU_TRACE_DRV_PRINT_CHAR, row, CURSOR_COLUMN_POSITION);
+        DRV_PRINT_CHAR(ctx, '>');
+    }
 }
 
 /**
  * @brief Display the name of a menu item at the given row.
  *
+ * @param ctx Menu context.
  * @param row Screen row to display the item
  * @param name Menu item name (fallback to "NO NAME" if NULL)
  */
-static void display_menu_item_name(uint8_t row, const char *name)
+static void display_menu_item_name(const menu_ctx_t *ctx, uint8_t row, const char *name)
 {
-    const char *text_to_print = name;
-    if (text_to_print == NULL)
+    MENU_TRACE_DRIVER(MENU_TRACE_DRV_CURSOR_POSITION, row, STRING_START_POSITION);
+    DRV_CURSOR_POSITION(ctx, row, STRING_START_POSITION);
+    print_text(ctx, row, STRING_START_POSITION, get_printable_name(name));
+}
+
+/**
+ * @brief Print a name or header at the current cursor position.
+ *
+ * With MENU_USE_FLASH_STRINGS the text is in program memory: it is printed
+ * with print_flash_string when provided, otherwise character by character.
+ *
+ * @param ctx Menu context.
+ * @param row Screen row (trace only).
+ * @param column Screen column (trace only).
+ * @param text Null-terminated name or header.
+ */
+static void print_text(const menu_ctx_t *ctx, uint8_t row, uint8_t column, const char *text)
+{
+    (void)row; /* Used by MENU_TRACE_DRIVER() only */
+    (void)column;
+#ifdef MENU_USE_FLASH_STRINGS
+    if (DRV_HAS_PRINT_FLASH_STRING(ctx))
     {
-        text_to_print = "NO NAME";
+        MENU_TRACE_DRIVER(MENU_TRACE_DRV_PRINT_FLASH_STRING, row, column);
+        DRV_PRINT_FLASH_STRING(ctx, text);
     }
-
-    DISPLAY->cursor_position(row, STRING_START_POSITION);
-    DISPLAY->print_string(text_to_print);
+    else
+    {
+        for (char c = MENU_TEXT_CHAR(text); c != '\0'; c = MENU_TEXT_CHAR(text))
+        {
+            MENU_TRACE_DRIVER(MENU_TRACE_DRV_PRINT_CHAR, row, column);
+            DRV_PRINT_CHAR(ctx, c);
+            text++;
+        }
+    }
+#else
+    MENU_TRACE_DRIVER(MENU_TRACE_DRV_PRINT_STRING, row, column);
+    DRV_PRINT_STRING(ctx, text);
+#endif
 }
 
 /** @} */ /* end of MenuLib group */
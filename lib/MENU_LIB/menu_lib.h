@@ -26,8 +26,75 @@ extern "C"
 
 #include "menu.h"
 #include "menu_lib_type.h"
+#include "menu_screen_driver_interface.h"
+#include <stdbool.h>
 #include <stdint.h>
 
+#ifndef MENU_MAX_CHARS_PER_LINE
+/**
+ * @brief Size of the engine line buffer used with the optional write_row driver
+ * entry and of a shadow buffer row (MENU_USE_SHADOW_BUFFER builds).
+ *
+ * Can be overridden in menu.h. Displays wider than this value are drawn
+ * without the line buffer.
+ */
+#define MENU_MAX_CHARS_PER_LINE 40U
+#endif
+
+#ifndef MENU_MAX_SCREEN_LINES
+/**
+ * @brief Number of rows of the shadow buffer (MENU_USE_SHADOW_BUFFER builds).
+ *
+ * Can be overridden in menu.h. Displays with more rows are drawn without
+ * the shadow buffer.
+ */
+#define MENU_MAX_SCREEN_LINES 4U
+#endif
+
+#ifndef MENU_EVENT_QUEUE_SIZE
+/**
+ * @brief Capacity of the navigation event queue (menu_post_event()).
+ *
+ * Can be overridden in menu.h. Must be a power of two, not greater than 128.
+ */
+#define MENU_EVENT_QUEUE_SIZE 8U
+#endif
+
+#if ((MENU_EVENT_QUEUE_SIZE & (MENU_EVENT_QUEUE_SIZE - 1U)) != 0U) || (MENU_EVENT_QUEUE_SIZE > 128U)
+#error "MENU_EVENT_QUEUE_SIZE must be a power of two not greater than 128"
+#endif
+
+#ifndef MENU_VALIDATED_MENUS_QTY
+/**
+ * @brief Number of menu roots remembered as validated by each context.
+ *
+ * Can be overridden in menu.h. menu_view_init() walks the whole tree only
+ * the first time a root is shown; when more roots are used, the oldest one
+ * is forgotten and validated again on its next menu_view_init().
+ */
+#define MENU_VALIDATED_MENUS_QTY 4U
+#endif
+
+#if (MENU_VALIDATED_MENUS_QTY == 0U) || (MENU_VALIDATED_MENUS_QTY > 255U)
+#error "MENU_VALIDATED_MENUS_QTY must be in range 1..255"
+#endif
+
+#ifdef MENU_USE_TRACE
+#ifndef MENU_TRACE_BUFFER_SIZE
+/**
+ * @brief Number of records kept in the trace ring (MENU_USE_TRACE builds).
+ *
+ * Can be overridden in menu.h. Must be a power of two, not greater than 32768.
+ * Every record takes 8 bytes of RAM.
+ */
+#define MENU_TRACE_BUFFER_SIZE 64U
+#endif
+
+#if ((MENU_TRACE_BUFFER_SIZE & (MENU_TRACE_BUFFER_SIZE - 1U)) != 0U) || (MENU_TRACE_BUFFER_SIZE > 32768U)
+#error "MENU_TRACE_BUFFER_SIZE must be a power of two not greater than 32768"
+#endif
+#endif
+
     /**
      * @typedef menu_exit_cb_t
      * @brief Callback type for handling top-level menu exit.
@@ -36,6 +103,63 @@ extern "C"
      */
     typedef void (*menu_exit_cb_t)(void);
 
+    /**
+     * @struct menu_ctx_t
+     * @brief Complete state of one menu engine instance.
+     *
+     * Each context holds its own display driver interface, navigation state
+     * and render state, so several menus can run independently (e.g. a front
+     * panel LCD and a service terminal). Fields are internal to the engine;
+     * the application only allocates the context and passes it to menu_ctx_*().
+     */
+    typedef struct menu_ctx_t
+    {
+        const struct menu_screen_driver_interface_struct *display; /**< Display driver used by this context */
+        bool initialized;                                         /**< Set by successful menu_ctx_init() */
+        uint8_t chars_per_line;                                   /**< Cached display width */
+        uint8_t screen_lines;                                     /**< Cached display height */
+
+#ifdef MENU_USE_COMPACT_TABLE
+        const menu_table_t *menu_table; /**< Menu table navigated by this context */
+#endif
+        menu_ref_t current_menu_pointer;                      /**< Currently selected menu item */
+        uint8_t menu_level;                                   /**< Current depth in the menu tree */
+        uint16_t cursor_selection_menu_index[MAX_MENU_DEPTH]; /**< Selected item index per level */
+        uint8_t cursor_row_position[MAX_MENU_DEPTH];          /**< Cursor row per level */
+        menu_ref_t window_top_menu[MAX_MENU_DEPTH];           /**< First visible item per level */
+#ifdef MENU_USE_SLIM_NODES
+        menu_ref_t root_menu_item;            /**< First top level item, start of the top level prev walk */
+        menu_ref_t menu_path[MAX_MENU_DEPTH]; /**< Item selected on each level above the current one (parent links) */
+#endif
+#ifdef MENU_USE_VIRTUAL_LISTS
+        const menu_list_provider_t *active_list; /**< Virtual list shown on the current level, NULL on regular levels */
+#endif
+
+        menu_exit_cb_t menu_top_level_exit_cb; /**< Called on ESC at the top level */
+        const char *custom_header;             /**< Optional top level header (NULL for default) */
+        const char *header_text;               /**< Header title of the current level, cached on level change */
+        uint8_t header_column;                 /**< First header title column (incl. padding), cached on level change */
+        bool header_padded;                    /**< Title printed with a space on both sides (submenu header) */
+
+#ifdef MENU_USE_SHADOW_BUFFER
+        char shadow_buffer[MENU_MAX_SCREEN_LINES][MENU_MAX_CHARS_PER_LINE]; /**< Copy of the characters sent to the display */
+        bool shadow_buffer_valid;                                           /**< True when shadow_buffer matches the display */
+#endif
+        menu_render_mode_t render_mode;  /**< Selected render strategy */
+        bool screen_view_valid;          /**< True when the drawn view matches drawn_* snapshot, cleared on level change */
+        uint8_t drawn_menu_level;        /**< Menu level of the last drawn view */
+        uint16_t drawn_window_top_index; /**< Selection index of the first visible item in the last drawn view */
+        menu_ref_t drawn_window_top;     /**< First visible item of the last drawn view (list owner on a virtual list level) */
+        uint8_t drawn_cursor_row;        /**< Cursor row of the last drawn view */
+
+        volatile uint8_t event_queue[MENU_EVENT_QUEUE_SIZE]; /**< Ring of posted menu_event_t values */
+        volatile uint8_t event_head;                         /**< Free running write index, written by menu_post_event() only */
+        volatile uint8_t event_tail;                         /**< Free running read index, written by menu_process() only */
+
+        menu_root_t *validated_menus[MENU_VALIDATED_MENUS_QTY]; /**< Roots that passed the tree validation */
+        uint8_t validated_menus_next;                          /**< Slot replaced by the next validated root */
+    } menu_ctx_t;
+
     /**
      * @brief Initialize the menu engine and display driver interface.
      *
@@ -56,16 +180,30 @@ extern "C"
      * Sets up the initial menu state, validates the menu structure,
      * and displays the first screen of the given root menu.
      *
-     * @param root_menu Pointer to the root of the menu tree.
+     * @param root_menu Pointer to the root of the menu tree (the menu table
+     * when MENU_USE_COMPACT_TABLE is defined).
      * @param menu_exit_cb Callback function invoked when exiting the top-level menu.
      * @param custom_menu_header Optional string for a custom menu header (can be NULL).
      * @return menu_status_t Status of the view initialization:
      * - MENU_OK — View initialized successfully.
      * - MENU_ERR_NOT_INITIALIZED — Menu system not initialized (menu_init() not called).
-     * - MENU_ERR_NO_MENU — Root menu pointer is NULL.
+     * - MENU_ERR_NO_MENU — Root menu pointer is NULL (or the menu table is empty).
      * - MENU_ERR_MENU_TOO_DEEP — Menu depth exceeds MAX_MENU_DEPTH.
+     * - MENU_ERR_MALFORMED_MENU — Inconsistent next/prev/parent links or a cycle in the menu tree.
+     *
+     * The tree is validated once per root; later calls with the same root skip
+     * the walk (see menu_clear_validated_menus()). The tree is never written,
+     * so it can be declared const and placed in flash.
      */
-    menu_status_t menu_view_init(menu_t *root_menu, menu_exit_cb_t menu_exit_cb, const char *custom_menu_header);
+    menu_status_t menu_view_init(menu_root_t *root_menu, menu_exit_cb_t menu_exit_cb, const char *custom_menu_header);
+
+    /**
+     * @brief Forget the menu roots validated by menu_view_init().
+     *
+     * Call after a menu tree was modified at run time, so the next
+     * menu_view_init() validates it again.
+     */
+    void menu_clear_validated_menus(void);
 
     /**
      * @brief Move selection to the next menu item.
@@ -99,6 +237,36 @@ extern "C"
      */
     void menu_esc(void);
 
+    /**
+     * @brief Move the selection by several menu items with a single redraw.
+     *
+     * Intended for rotary encoders and accelerated key repetition. The move
+     * stops at the first or the last item of the current level.
+     *
+     * @param delta Number of items to move (positive down, negative up).
+     */
+    void menu_move_by(int16_t delta);
+
+    /**
+     * @brief Move the selection down by one screen of menu rows.
+     */
+    void menu_page_down(void);
+
+    /**
+     * @brief Move the selection up by one screen of menu rows.
+     */
+    void menu_page_up(void);
+
+    /**
+     * @brief Select the first item of the current menu level.
+     */
+    void menu_first(void);
+
+    /**
+     * @brief Select the last item of the current menu level.
+     */
+    void menu_last(void);
+
     /**
      * @brief Refresh the screen view.
      *
@@ -108,14 +276,202 @@ extern "C"
      */
     void update_screen_view(void);
 
+    /**
+     * @brief Select the rendering strategy used after navigation steps.
+     *
+     * In MENU_RENDER_INCREMENTAL mode the engine remembers the last drawn
+     * window and cursor row. Moving the cursor inside a window that does not
+     * scroll only rewrites the old and the new cursor marker cells. Scrolling,
+     * level changes and update_screen_view() always perform a full redraw.
+     *
+     * @note When the application draws over the menu (e.g. from an item callback),
+     * it must call update_screen_view() before returning control to the menu.
+     *
+     * @param mode Rendering mode (MENU_RENDER_FULL is the default).
+     */
+    void menu_set_render_mode(menu_render_mode_t mode);
+
     /**
      * @brief Get the current menu position pointer.
      *
      * Returns a pointer to the currently selected menu item.
      *
-     * @return menu_t* Pointer to the current menu item.
+     * @return menu_ref_t Const pointer to the current menu item (node index
+     * when MENU_USE_COMPACT_TABLE is defined).
+     */
+    menu_ref_t get_current_menu_position(void);
+
+    /**
+     * @brief Queue a navigation event without touching the display.
+     *
+     * Runs in constant time and may be called from an interrupt handler
+     * (e.g. an encoder or keypad ISR). The queue is single-producer /
+     * single-consumer: events must be posted from one context at a time,
+     * while menu_process() runs in the main loop.
+     *
+     * @param event Navigation event.
+     * @return menu_status_t
+     * - MENU_OK — Event queued.
+     * - MENU_ERR_EVENT_QUEUE_FULL — MENU_EVENT_QUEUE_SIZE events already pending, event dropped.
+     */
+    menu_status_t menu_post_event(menu_event_t event);
+
+    /**
+     * @brief Apply all queued navigation events and render the view once.
+     *
+     * Ten NEXT events posted between two calls move the cursor ten items and
+     * cause a single redraw. An event that runs an item callback or the
+     * top-level exit callback ends the processing: the view reached so far is
+     * rendered, events still queued behind it are discarded and the callback
+     * is called.
+     */
+    void menu_process(void);
+
+    /**
+     * @brief Initialize a menu context with the given display driver interface.
+     *
+     * Context based counterpart of menu_init(). The context keeps its own
+     * driver, so several contexts may drive different displays.
+     *
+     * @param ctx Context to initialize.
+     * @param display Display driver interface used by this context.
+     * @return menu_status_t Status of the initialization:
+     * - MENU_OK — Initialization successful.
+     * - MENU_ERR_NO_CONTEXT — ctx is NULL.
+     * - MENU_ERR_NO_DISPLAY_INTERFACE — display is NULL.
+     * - MENU_ERR_INCOMPLETE_INTERFACE — Display driver functions missing.
+     */
+    menu_status_t menu_ctx_init(menu_ctx_t *ctx, const struct menu_screen_driver_interface_struct *display);
+
+    /**
+     * @brief Initialize and display a menu view in the given context.
+     *
+     * @see menu_view_init()
+     */
+    menu_status_t menu_ctx_view_init(menu_ctx_t *ctx, menu_root_t *root_menu, menu_exit_cb_t menu_exit_cb, const char *custom_menu_header);
+
+    /*
+     * The context based navigation and view functions below do nothing
+     * when ctx is NULL.
+     */
+
+    /** @brief Context based counterpart of menu_clear_validated_menus(). */
+    void menu_ctx_clear_validated_menus(menu_ctx_t *ctx);
+
+    /** @brief Context based counterpart of menu_next(). */
+    void menu_ctx_next(menu_ctx_t *ctx);
+
+    /** @brief Context based counterpart of menu_prev(). */
+    void menu_ctx_prev(menu_ctx_t *ctx);
+
+    /** @brief Context based counterpart of menu_enter(). */
+    void menu_ctx_enter(menu_ctx_t *ctx);
+
+    /** @brief Context based counterpart of menu_esc(). */
+    void menu_ctx_esc(menu_ctx_t *ctx);
+
+    /** @brief Context based counterpart of menu_move_by(). */
+    void menu_ctx_move_by(menu_ctx_t *ctx, int16_t delta);
+
+    /** @brief Context based counterpart of menu_page_down(). */
+    void menu_ctx_page_down(menu_ctx_t *ctx);
+
+    /** @brief Context based counterpart of menu_page_up(). */
+    void menu_ctx_page_up(menu_ctx_t *ctx);
+
+    /** @brief Context based counterpart of menu_first(). */
+    void menu_ctx_first(menu_ctx_t *ctx);
+
+    /** @brief Context based counterpart of menu_last(). */
+    void menu_ctx_last(menu_ctx_t *ctx);
+
+    /** @brief Context based counterpart of update_screen_view(). */
+    void menu_ctx_update_screen_view(menu_ctx_t *ctx);
+
+    /** @brief Context based counterpart of menu_set_render_mode(). */
+    void menu_ctx_set_render_mode(menu_ctx_t *ctx, menu_render_mode_t mode);
+
+    /**
+     * @brief Context based counterpart of get_current_menu_position().
+     *
+     * @return menu_ref_t Current menu item, MENU_NO_NODE when ctx is NULL.
+     */
+    menu_ref_t menu_ctx_get_current_menu_position(const menu_ctx_t *ctx);
+
+    /**
+     * @brief Context based counterpart of menu_post_event().
+     *
+     * @return menu_status_t Additionally MENU_ERR_NO_CONTEXT when ctx is NULL.
+     */
+    menu_status_t menu_ctx_post_event(menu_ctx_t *ctx, menu_event_t event);
+
+    /**
+     * @brief Context based counterpart of menu_process().
+     *
+     * @return menu_status_t MENU_OK, or MENU_ERR_NO_CONTEXT when ctx is NULL.
+     */
+    menu_status_t menu_ctx_process(menu_ctx_t *ctx);
+
+#ifdef MENU_USE_TRACE
+    /**
+     * @typedef menu_trace_tick_func_ptr
+     * @brief Tick source used to timestamp trace records (e.g. a us or ms timer).
+     */
+    typedef uint32_t (*menu_trace_tick_func_ptr)(void);
+
+    /**
+     * @typedef menu_trace_write_func_ptr
+     * @brief Byte sink used by menu_trace_dump() (e.g. a debug UART transmit function).
+     */
+    typedef void (*menu_trace_write_func_ptr)(const uint8_t *data, uint16_t len);
+
+    /**
+     * @brief Set the function used to timestamp trace records.
+     *
+     * @param tick Tick source, NULL writes 0 timestamps.
      */
-    menu_t *get_current_menu_position(void);
+    void menu_trace_set_tick_source(menu_trace_tick_func_ptr tick);
+
+    /**
+     * @brief Write one record to the trace ring.
+     *
+     * Called by the engine hooks; the application may add its own records
+     * (e.g. key press detection) with ids not used by menu_trace_event_t.
+     * When the ring is full the oldest record is overwritten.
+     *
+     * @param event Record id.
+     * @param level Menu level or display row.
+     * @param index Selection index, display column or length.
+     */
+    void menu_trace_record(uint8_t event, uint8_t level, uint16_t index);
+
+    /**
+     * @brief Copy the recorded trace, oldest record first.
+     *
+     * @param records Destination buffer.
+     * @param max_records Capacity of the destination buffer.
+     * @return uint16_t Number of copied records (the newest ones when max_records is too small).
+     */
+    uint16_t menu_trace_read(menu_trace_record_t *records, uint16_t max_records);
+
+    /**
+     * @brief Remove all records from the trace ring.
+     */
+    void menu_trace_clear(void);
+
+    /**
+     * @brief Send the recorded trace as a binary dump, oldest record first.
+     *
+     * The dump starts with an 8 byte header: "MTRC", format version (1),
+     * record size (8) and the number of records (16 bit little endian).
+     * Each record follows as event, level, index (16 bit little endian) and
+     * timestamp (32 bit little endian). tools/menu_trace_decode.py turns a
+     * dump into a timeline.
+     *
+     * @param write Byte sink called once for the header and once per record.
+     */
+    void menu_trace_dump(menu_trace_write_func_ptr write);
+#endif
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,308 @@
+/**
+ * @file menu_lib.hpp
+ * @author niwciu (niwciu@gmail.com)
+ * @brief Compile-time menu definition for C++17 builds.
+ * @version 1.0.0
+ * @date 2025-12-08
+ *
+ * Header-only layer describing a menu tree as nested item()/submenu() calls
+ * and turning it at compile time into a const compact menu table
+ * (MENU_USE_COMPACT_TABLE). All next/prev/child/parent links are derived from
+ * the nesting, the tree depth is checked against MAX_MENU_DEPTH with a static
+ * assertion and the table is marked as checked, so menu_view_init() does not
+ * walk it at run time.
+ *
+ * @code
+ * MENU_TABLE_DEFINE(main_menu_table,
+ *     menu_lib::item("Start", on_start),
+ *     menu_lib::submenu("Settings",
+ *         menu_lib::item("Brightness", on_brightness),
+ *         menu_lib::item("Contrast", on_contrast)),
+ *     menu_lib::item("About"));
+ *
+ * static_assert(main_menu_table_storage.max_name_length < LCD_X, "item names do not fit the display");
+ * @endcode
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * @ingroup MenuLib
+ */
+
+#ifndef _MENU_LIB_HPP_
+#define _MENU_LIB_HPP_
+
+#include "menu_lib.h"
+#include <cstddef>
+#include <cstdint>
+
+#ifndef MENU_USE_COMPACT_TABLE
+#error "menu_lib.hpp builds compact menu tables, define MENU_USE_COMPACT_TABLE in menu.h"
+#endif
+
+#if __cplusplus < 201703L
+#error "menu_lib.hpp requires C++17"
+#endif
+
+namespace menu_lib
+{
+    /**
+     * @brief Menu item collected by item()/submenu(), in depth first order.
+     */
+    struct node_def
+    {
+        const char *name;         /**< NUL terminated item name */
+        std::uint16_t name_len;   /**< Name length without the NUL */
+        menu_callback_t callback; /**< Item callback, nullptr for none */
+        bool has_callback_slot;   /**< Item reserves an entry in the callback table */
+        std::uint8_t level;       /**< Depth of the item, 0 on the top level */
+    };
+
+    /**
+     * @brief Depth first list of menu items.
+     *
+     * @tparam NodeQty Number of items.
+     * @tparam NamesSize Size of all names including their NUL characters.
+     * @tparam CallbackQty Number of items given a callback.
+     */
+    template <std::size_t NodeQty, std::size_t NamesSize, std::size_t CallbackQty>
+    struct tree_def
+    {
+        node_def nodes[NodeQty]; /**< Items in depth first order */
+    };
+
+    /**
+     * @brief Menu item without a callback.
+     *
+     * @param name Item name (string literal).
+     */
+    template <std::size_t N>
+    constexpr tree_def<1U, N, 0U> item(const char (&name)[N])
+    {
+        return tree_def<1U, N, 0U>{{{name, static_cast<std::uint16_t>(N - 1U), nullptr, false, 0U}}};
+    }
+
+    /**
+     * @brief Menu item calling a callback on ENTER.
+     *
+     * @param name Item name (string literal).
+     * @param callback Function executed when the item is entered.
+     */
+    template <std::size_t N>
+    constexpr tree_def<1U, N, 1U> item(const char (&name)[N], menu_callback_t callback)
+    {
+        return tree_def<1U, N, 1U>{{{name, static_cast<std::uint16_t>(N - 1U), callback, true, 0U}}};
+    }
+
+    /**
+     * @brief Append the items of a child list one level deeper.
+     */
+    template <std::size_t TreeQty, std::size_t TreeNamesSize, std::size_t TreeCallbackQty,
+              std::size_t NodeQty, std::size_t NamesSize, std::size_t CallbackQty>
+    constexpr std::size_t append_nodes(tree_def<TreeQty, TreeNamesSize, TreeCallbackQty> &tree, std::size_t position,
+                                       const tree_def<NodeQty, NamesSize, CallbackQty> &list, std::uint8_t level_offset)
+    {
+        for (std::size_t i = 0U; i < NodeQty; i++)
+        {
+            tree.nodes[position + i] = list.nodes[i];
+            tree.nodes[position + i].level = static_cast<std::uint8_t>(list.nodes[i].level + level_offset);
+        }
+
+        return position + NodeQty;
+    }
+
+    /**
+     * @brief Menu item opening a submenu with the given items.
+     *
+     * @param name Item name (string literal).
+     * @param children Items of the submenu, in display order.
+     */
+    template <std::size_t N, std::size_t... Qty, std::size_t... Size, std::size_t... Cb>
+    constexpr tree_def<1U + (0U + ... + Qty), N + (0U + ... + Size), (0U + ... + Cb)>
+    submenu(const char (&name)[N], const tree_def<Qty, Size, Cb> &...children)
+    {
+        static_assert(sizeof...(children) > 0U, "submenu() needs at least one item");
+
+        tree_def<1U + (0U + ... + Qty), N + (0U + ... + Size), (0U + ... + Cb)> tree{};
+        std::size_t position = 1U;
+
+        tree.nodes[0] = node_def{name, static_cast<std::uint16_t>(N - 1U), nullptr, false, 0U};
+        ((position = append_nodes(tree, position, children, 1U)), ...);
+
+        return tree;
+    }
+
+    /**
+     * @brief Top level of the menu: the given items in display order.
+     */
+    template <std::size_t... Qty, std::size_t... Size, std::size_t... Cb>
+    constexpr tree_def<(0U + ... + Qty), (0U + ... + Size), (0U + ... + Cb)> menu(const tree_def<Qty, Size, Cb> &...items)
+    {
+        static_assert(sizeof...(items) > 0U, "menu() needs at least one item");
+
+        tree_def<(0U + ... + Qty), (0U + ... + Size), (0U + ... + Cb)> tree{};
+        std::size_t position = 0U;
+
+        ((position = append_nodes(tree, position, items, 0U)), ...);
+
+        return tree;
+    }
+
+    /**
+     * @brief Number of levels of a menu tree.
+     */
+    template <std::size_t NodeQty, std::size_t NamesSize, std::size_t CallbackQty>
+    constexpr std::uint8_t get_depth(const tree_def<NodeQty, NamesSize, CallbackQty> &tree)
+    {
+        std::uint8_t depth = 0U;
+
+        for (std::size_t i = 0U; i < NodeQty; i++)
+        {
+            if (tree.nodes[i].level >= depth)
+            {
+                depth = static_cast<std::uint8_t>(tree.nodes[i].level + 1U);
+            }
+        }
+
+        return depth;
+    }
+
+    /**
+     * @brief Table data emitted for a menu tree, placed in flash as one const object.
+     */
+    template <std::size_t NodeQty, std::size_t NamesSize, std::size_t CallbackQty>
+    struct table_storage
+    {
+        menu_node_t nodes[NodeQty];                                        /**< Linked compact nodes */
+        char names[NamesSize];                                             /**< Concatenated NUL terminated names */
+        menu_callback_t callbacks[(CallbackQty > 0U) ? CallbackQty : 1U]; /**< Callbacks referenced by callback_id */
+        std::uint8_t depth;                                                /**< Number of menu levels */
+        std::uint16_t level_items_qty[MAX_MENU_DEPTH];                     /**< Number of items on every level */
+        std::uint16_t max_name_length;                                     /**< Longest item name */
+    };
+
+    /**
+     * @brief Find the node linked in the given direction on the same level.
+     *
+     * @param step -1 for the previous item, 1 for the next one.
+     */
+    template <std::size_t NodeQty, std::size_t NamesSize, std::size_t CallbackQty>
+    constexpr menu_index_t find_sibling(const tree_def<NodeQty, NamesSize, CallbackQty> &tree, std::size_t index, int step)
+    {
+        menu_index_t sibling = MENU_NO_NODE;
+        std::uint8_t level = tree.nodes[index].level;
+        std::size_t i = index;
+        bool searching = true;
+
+        while (searching && (((step < 0) && (i > 0U)) || ((step > 0) && ((i + 1U) < NodeQty))))
+        {
+            i = (step < 0) ? (i - 1U) : (i + 1U);
+            if (tree.nodes[i].level <= level)
+            {
+                sibling = (tree.nodes[i].level == level) ? static_cast<menu_index_t>(i) : MENU_NO_NODE;
+                searching = false; /* found the sibling or left the submenu */
+            }
+        }
+
+        return sibling;
+    }
+
+    /**
+     * @brief Find the item whose submenu contains the node.
+     */
+    template <std::size_t NodeQty, std::size_t NamesSize, std::size_t CallbackQty>
+    constexpr menu_index_t find_parent(const tree_def<NodeQty, NamesSize, CallbackQty> &tree, std::size_t index)
+    {
+        menu_index_t parent = MENU_NO_NODE;
+        std::uint8_t level = tree.nodes[index].level;
+
+        for (std::size_t i = index; (i > 0U) && (parent == MENU_NO_NODE) && (level > 0U); i--)
+        {
+            if (tree.nodes[i - 1U].level < level)
+            {
+                parent = static_cast<menu_index_t>(i - 1U);
+            }
+        }
+
+        return parent;
+    }
+
+    /**
+     * @brief Build the compact table data of a menu tree.
+     */
+    template <std::size_t NodeQty, std::size_t NamesSize, std::size_t CallbackQty>
+    constexpr table_storage<NodeQty, NamesSize, CallbackQty> build_table(const tree_def<NodeQty, NamesSize, CallbackQty> &tree)
+    {
+        table_storage<NodeQty, NamesSize, CallbackQty> storage{};
+        std::size_t name_offset = 0U;
+        std::size_t callback_id = 0U;
+
+        storage.depth = get_depth(tree);
+        for (std::size_t i = 0U; i < NodeQty; i++)
+        {
+            const node_def &def = tree.nodes[i];
+            menu_node_t &node = storage.nodes[i];
+
+            node.name_offset = static_cast<std::uint16_t>(name_offset);
+            node.next = find_sibling(tree, i, 1);
+            node.prev = find_sibling(tree, i, -1);
+            node.child = (((i + 1U) < NodeQty) && (tree.nodes[i + 1U].level > def.level)) ? static_cast<menu_index_t>(i + 1U) : MENU_NO_NODE;
+            node.parent = find_parent(tree, i);
+            node.callback_id = MENU_NO_CALLBACK;
+            if (def.has_callback_slot)
+            {
+                storage.callbacks[callback_id] = def.callback;
+                node.callback_id = (def.callback != nullptr) ? static_cast<std::uint8_t>(callback_id) : MENU_NO_CALLBACK;
+                callback_id++;
+            }
+
+            for (std::size_t c = 0U; c <= def.name_len; c++)
+            {
+                storage.names[name_offset + c] = def.name[c];
+            }
+            name_offset += def.name_len + 1U;
+
+            if (def.level < MAX_MENU_DEPTH)
+            {
+                storage.level_items_qty[def.level]++;
+            }
+            if (def.name_len > storage.max_name_length)
+            {
+                storage.max_name_length = def.name_len;
+            }
+        }
+
+        return storage;
+    }
+} // namespace menu_lib
+
+/**
+ * @brief Define a const compact menu table from nested menu_lib::item()/submenu() calls.
+ *
+ * Emits `<table_name>_storage` (constexpr nodes, names, callbacks and the
+ * depth, level_items_qty and max_name_length of the tree) and
+ * `const menu_table_t <table_name>` to pass to menu_view_init(). A tree
+ * deeper than MAX_MENU_DEPTH, with more items than menu_index_t can address,
+ * more than 255 callbacks or more than 64 KiB of names does not compile.
+ *
+ * @param table_name Name of the emitted menu_table_t.
+ * @param ... Top level items in display order.
+ */
+#define MENU_TABLE_DEFINE(table_name, ...)                                                                                   \
+    constexpr auto table_name##_tree = ::menu_lib::menu(__VA_ARGS__);                                                        \
+    static_assert(::menu_lib::get_depth(table_name##_tree) <= MAX_MENU_DEPTH, #table_name " is deeper than MAX_MENU_DEPTH"); \
+    constexpr auto table_name##_storage = ::menu_lib::build_table(table_name##_tree);                                        \
+    static_assert(MENU_TABLE_ENTRIES_QTY(table_name##_storage.nodes) < MENU_NO_NODE,                                          \
+                  #table_name " has more items than menu_index_t can address (see MENU_COMPACT_INDEX_16)");                   \
+    static_assert(MENU_TABLE_ENTRIES_QTY(table_name##_storage.callbacks) < MENU_NO_CALLBACK,                                  \
+                  #table_name " has more callbacks than callback_id can address");                                           \
+    static_assert(sizeof(table_name##_storage.names) <= 0x10000U, #table_name " names exceed 64 KiB");                     \
+    const menu_table_t table_name = {table_name##_storage.nodes,                                                             \
+                                     table_name##_storage.names,                                                             \
+                                     table_name##_storage.callbacks,                                                         \
+                                     static_cast<menu_index_t>(MENU_TABLE_ENTRIES_QTY(table_name##_storage.nodes)),          \
+                                     table_name##_storage.depth}
+
+/** @brief Number of entries of a table_storage array. */
+#define MENU_TABLE_ENTRIES_QTY(array) (sizeof(array) / sizeof((array)[0]))
+
+#endif /* _MENU_LIB_HPP_ */
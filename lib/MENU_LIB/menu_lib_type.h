@@ -8,6 +8,20 @@
  * This header defines core data types used by the menu library,
  * including menu status codes and the menu item structure.
  *
+ * Two menu item formats are available:
+ * - pointer linked menu_t items (default),
+ * - compact, index based menu_table_t selected with MENU_USE_COMPACT_TABLE
+ *   (8 bit indices, or 16 bit when MENU_COMPACT_INDEX_16 is also defined).
+ * Defining MENU_USE_VIRTUAL_LISTS adds virtual list support to menu_t items
+ * (entries provided by callbacks, pointer linked format only).
+ * Defining MENU_USE_SLIM_NODES removes the prev and parent links from menu_t
+ * (pointer linked format only), the engine derives them from the navigation path.
+ * Defining MENU_USE_FLASH_STRINGS makes item names and menu headers program
+ * memory strings (pointer linked and compact formats).
+ * Defining MENU_USE_TRACE adds the trace record types.
+ * The selection macros must be defined before this header is included
+ * (at the top of menu.h) or passed as global compiler definitions.
+ *
  * @copyright Copyright (c) 2025
  *
  * @ingroup MenuLib
@@ -16,6 +30,8 @@
 #ifndef _MENU_LIB_TYPE_
 #define _MENU_LIB_TYPE_
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -36,9 +52,114 @@ extern "C"
         MENU_ERR_NOT_INITIALIZED = 3,      /**< Menu system not initialized (menu_init() not called) */
         MENU_ERR_NO_MENU = 4,              /**< Root menu pointer is NULL */
         MENU_ERR_MENU_TOO_DEEP = 5,        /**< Menu depth exceeds MAX_MENU_DEPTH */
-        MENU_ERR_NULL_MENU_ITEM = 6        /**< Encountered NULL menu item pointer during view update */
+        MENU_ERR_NULL_MENU_ITEM = 6,       /**< Encountered NULL menu item pointer during view update */
+        MENU_ERR_NO_CONTEXT = 7,           /**< Menu context pointer is NULL */
+        MENU_ERR_EVENT_QUEUE_FULL = 8,     /**< Navigation event queue is full, event dropped */
+        MENU_ERR_MALFORMED_MENU = 9        /**< Inconsistent next/prev/parent links, a cycle in the menu tree or a virtual list item with a submenu */
     } menu_status_t;
 
+    /**
+     * @enum menu_render_mode_t
+     * @brief Rendering strategy used by the menu engine.
+     *
+     * Selects how much of the screen is redrawn after a navigation step.
+     */
+    typedef enum
+    {
+        MENU_RENDER_FULL = 0,       /**< Redraw header and all menu rows on every navigation step */
+        MENU_RENDER_INCREMENTAL = 1 /**< Redraw only changed cells; full redraw on scroll, level change or explicit request */
+    } menu_render_mode_t;
+
+    /**
+     * @enum menu_event_t
+     * @brief Navigation events accepted by menu_post_event().
+     */
+    typedef enum
+    {
+        MENU_EVENT_NEXT = 0,  /**< Same as menu_next() */
+        MENU_EVENT_PREV = 1,  /**< Same as menu_prev() */
+        MENU_EVENT_ENTER = 2, /**< Same as menu_enter() */
+        MENU_EVENT_ESC = 3    /**< Same as menu_esc() */
+    } menu_event_t;
+
+#ifdef MENU_USE_TRACE
+    /**
+     * @enum menu_trace_event_t
+     * @brief Ids of the records written by the MENU_USE_TRACE hooks.
+     *
+     * Navigation and view ids mark the function entry; the exit record has
+     * MENU_TRACE_END_FLAG set. Navigation and view records carry the menu
+     * level and the selection index. Driver call records carry the display
+     * row and the column of the call (print_char, print_string and
+     * print_flash_string: the column set by the preceding cursor_position(),
+     * write_row and fill: the number of written characters).
+     */
+    typedef enum
+    {
+        MENU_TRACE_NEXT = 1,                    /**< menu_next() / menu_ctx_next() */
+        MENU_TRACE_PREV = 2,                    /**< menu_prev() / menu_ctx_prev() */
+        MENU_TRACE_ENTER = 3,                   /**< menu_enter() / menu_ctx_enter() */
+        MENU_TRACE_ESC = 4,                     /**< menu_esc() / menu_ctx_esc() */
+        MENU_TRACE_UPDATE_VIEW = 5,             /**< Screen view update after a navigation step or refresh */
+        MENU_TRACE_DRV_SCREEN_INIT = 16,        /**< Driver screen_init() call */
+        MENU_TRACE_DRV_CURSOR_POSITION = 17,    /**< Driver cursor_position() call */
+        MENU_TRACE_DRV_PRINT_STRING = 18,       /**< Driver print_string() call */
+        MENU_TRACE_DRV_PRINT_CHAR = 19,         /**< Driver print_char() call */
+        MENU_TRACE_DRV_WRITE_ROW = 20,          /**< Driver write_row() call */
+        MENU_TRACE_DRV_FILL = 21,               /**< Driver fill() call */
+        MENU_TRACE_DRV_PRINT_FLASH_STRING = 22, /**< Driver print_flash_string() call */
+        MENU_TRACE_END_FLAG = 0x80              /**< Set in the exit record of navigation and view ids */
+    } menu_trace_event_t;
+
+    /**
+     * @struct menu_trace_record_t
+     * @brief One 8 byte record of the trace ring.
+     */
+    typedef struct
+    {
+        uint8_t event;      /**< menu_trace_event_t value, MENU_TRACE_END_FLAG for exit records */
+        uint8_t level;      /**< Menu level (driver calls: row) */
+        uint16_t index;     /**< Selection index (driver calls: column or length) */
+        uint32_t timestamp; /**< Value of the tick source, 0 when no tick source is set */
+    } menu_trace_record_t;
+#endif
+
+    /**
+     * @typedef menu_callback_t
+     * @brief Function executed when a leaf menu item is selected.
+     */
+    typedef void (*menu_callback_t)(void);
+
+#if defined(MENU_USE_VIRTUAL_LISTS) && defined(MENU_USE_COMPACT_TABLE)
+#error "MENU_USE_VIRTUAL_LISTS is available for the pointer linked menu_t format only"
+#endif
+
+#if defined(MENU_USE_SLIM_NODES) && defined(MENU_USE_COMPACT_TABLE)
+#error "MENU_USE_SLIM_NODES is available for the pointer linked menu_t format only"
+#endif
+
+#if defined(MENU_USE_VIRTUAL_LISTS) && defined(MENU_USE_FLASH_STRINGS)
+#error "MENU_USE_VIRTUAL_LISTS cannot be combined with MENU_USE_FLASH_STRINGS (virtual list names are composed in RAM)"
+#endif
+
+#ifndef MENU_USE_COMPACT_TABLE
+#ifdef MENU_USE_VIRTUAL_LISTS
+    /**
+     * @struct menu_list_provider_t
+     * @brief Source of the entries of a virtual menu list.
+     *
+     * The entries are not stored as menu items. The engine asks the provider
+     * for the number of entries and for the names of the rows visible on the
+     * screen only, so the RAM used does not depend on the length of the list.
+     */
+    typedef struct menu_list_provider_t
+    {
+        uint16_t (*count)(void);                                  /**< Number of entries in the list. */
+        void (*get_name)(uint16_t index, char *buf, uint8_t len); /**< Write the NUL terminated name of an entry, at most len bytes incl. NUL. */
+        void (*on_select)(uint16_t index);                        /**< Called when an entry is entered (can be NULL). */
+    } menu_list_provider_t;
+#endif /* MENU_USE_VIRTUAL_LISTS */
+
     /**
      * @struct menu_t
      * @brief Represents a single menu item in a hierarchical menu system.
@@ -47,17 +168,87 @@ extern "C"
      * and can optionally point to a submenu (child) or its parent menu for multi-level navigation.
      * A callback function can be assigned to a menu item to execute specific functionality
      * when the item is selected.
+     *
+     * With MENU_USE_SLIM_NODES the prev and parent links are not stored
+     * ({name, next, child, callback} initializers). An item is always reached
+     * through the child link of its parent and the next links of its level,
+     * so the engine finds both on the navigation path it keeps in menu_ctx_t.
      */
     typedef struct menu_t
     {
-        const char *name;       /**< Name of the menu item (displayed on the screen). */
-        struct menu_t *next;    /**< Pointer to the next menu item on the same level. */
-        struct menu_t *prev;    /**< Pointer to the previous menu item on the same level. */
-        struct menu_t *child;   /**< Pointer to the submenu (child menu) of this item. */
-        struct menu_t *parent;  /**< Pointer to the parent menu of this item. */
-        void (*callback)(void); /**< Callback function executed when the menu item is selected. */
+        const char *name;            /**< Name of the menu item (displayed on the screen). */
+        const struct menu_t *next;   /**< Pointer to the next menu item on the same level. */
+#ifndef MENU_USE_SLIM_NODES
+        const struct menu_t *prev;   /**< Pointer to the previous menu item on the same level. */
+#endif
+        const struct menu_t *child;  /**< Pointer to the submenu (child menu) of this item. */
+#ifndef MENU_USE_SLIM_NODES
+        const struct menu_t *parent; /**< Pointer to the parent menu of this item. */
+#endif
+        void (*callback)(void);      /**< Callback function executed when the menu item is selected. */
+#ifdef MENU_USE_VIRTUAL_LISTS
+        const menu_list_provider_t *list; /**< Virtual list opened instead of a submenu (child must be NULL), NULL for regular items. */
+#endif
     } menu_t;
 
+    /** @brief Reference to a menu item used by the engine API. */
+    typedef const menu_t *menu_ref_t;
+
+    /** @brief Type passed to menu_view_init() as the menu root. */
+    typedef const menu_t menu_root_t;
+
+#define MENU_NO_NODE NULL /**< Reference of a missing menu item */
+
+#else /* MENU_USE_COMPACT_TABLE */
+
+#ifdef MENU_COMPACT_INDEX_16
+    typedef uint16_t menu_index_t; /**< Node index, up to 65535 nodes */
+#else
+    typedef uint8_t menu_index_t; /**< Node index, up to 255 nodes */
+#endif
+
+#define MENU_NO_NODE ((menu_index_t)~(menu_index_t)0U) /**< Index of a missing menu item */
+#define MENU_NO_CALLBACK 0xFFU                         /**< callback_id of an item without callback */
+#define MENU_ROOT_NODE ((menu_index_t)0U)              /**< Index of the first top level item */
+
+    /**
+     * @struct menu_node_t
+     * @brief Packed menu item of a compact menu table.
+     *
+     * Links are indices into menu_table_t::nodes and the name is an offset into
+     * menu_table_t::names, so a whole table can be declared `const` and stay in flash.
+     */
+    typedef struct
+    {
+        uint16_t name_offset; /**< Offset of the NUL terminated name in menu_table_t::names */
+        menu_index_t next;    /**< Next item on the same level or MENU_NO_NODE */
+        menu_index_t prev;    /**< Previous item on the same level or MENU_NO_NODE */
+        menu_index_t child;   /**< First item of the submenu or MENU_NO_NODE */
+        menu_index_t parent;  /**< Parent item or MENU_NO_NODE on the top level */
+        uint8_t callback_id;  /**< Index in menu_table_t::callbacks or MENU_NO_CALLBACK */
+    } menu_node_t;
+
+    /**
+     * @struct menu_table_t
+     * @brief Compact, const menu tree. Node 0 is the first top level item.
+     */
+    typedef struct
+    {
+        const menu_node_t *nodes;         /**< Array of packed menu items */
+        const char *names;                /**< Concatenated NUL terminated item names */
+        const menu_callback_t *callbacks; /**< Callbacks referenced by menu_node_t::callback_id */
+        menu_index_t node_count;          /**< Number of items in nodes */
+        uint8_t checked_depth;            /**< Tree depth checked at compile time by MENU_TABLE_DEFINE (menu_lib.hpp), 0 if not checked */
+    } menu_table_t;
+
+    /** @brief Reference to a menu item used by the engine API. */
+    typedef menu_index_t menu_ref_t;
+
+    /** @brief Type passed to menu_view_init() as the menu root. */
+    typedef const menu_table_t menu_root_t;
+
+#endif /* MENU_USE_COMPACT_TABLE */
+
 #ifdef __cplusplus
 }
 #endif    /* __cplusplus */
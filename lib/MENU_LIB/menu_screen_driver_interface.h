@@ -50,10 +50,38 @@ extern "C"
      */
     typedef void (*print_char_func_ptr)(const char character);
 
+    /**
+     * @brief Function pointer type for writing a complete row.
+     * @param row Row index on the screen
+     * @param buf Characters to write starting at the first column (not null-terminated)
+     * @param len Number of characters in buf
+     */
+    typedef void (*write_row_func_ptr)(uint8_t row, const char *buf, uint8_t len);
+
+    /**
+     * @brief Function pointer type for filling a part of a row with one character.
+     * @param row Row index on the screen
+     * @param column Column index of the first filled cell
+     * @param character Fill character
+     * @param len Number of cells to fill
+     */
+    typedef void (*fill_func_ptr)(uint8_t row, uint8_t column, char character, uint8_t len);
+
     /**
      * @brief Interface struct containing display driver function pointers.
      *
      * Provides abstraction for menu rendering and screen manipulation.
+     *
+     * write_row and fill are optional. When write_row is provided, the engine
+     * composes each row in a line buffer and sends it with one call, which lets
+     * I2C, SPI or UART backed drivers send a row as one bus transaction.
+     * Otherwise fill (if provided) replaces the per-character loops, and the
+     * remaining output uses cursor_position/print_string/print_char.
+     *
+     * print_flash_string is optional and used with MENU_USE_FLASH_STRINGS only:
+     * item names and headers are passed to it as program memory addresses
+     * (e.g. a pgm_read_byte() based lcd_buf_str_P() on AVR). Without it they
+     * are read by the engine and printed with print_char.
      */
     struct menu_screen_driver_interface_struct
     {
@@ -64,6 +92,9 @@ extern "C"
         screen_position_func_ptr cursor_position;              /**< Set cursor position */
         print_string_func_ptr print_string;                    /**< Print null-terminated string */
         print_char_func_ptr print_char;                        /**< Print single character */
+        write_row_func_ptr write_row;                          /**< Optional: write a complete row in one call (NULL if not supported) */
+        fill_func_ptr fill;                                    /**< Optional: fill cells with one character in one call (NULL if not supported) */
+        print_string_func_ptr print_flash_string;              /**< Optional: print a null-terminated program memory string (MENU_USE_FLASH_STRINGS, NULL if not supported) */
     };
 
     /**
@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+"""Decode a MENU_LIB trace dump (menu_trace_dump()) into a timeline.
+
+The dump may be given as the raw binary bytes or as hex text (e.g. bytes
+captured from a debug UART and printed as "4D 54 52 43 ..."), whitespace is
+ignored. Navigation and view records are printed with their duration and
+nested driver calls are indented under the function they belong to.
+
+usage:
+    python3 menu_trace_decode.py dump.bin
+    python3 menu_trace_decode.py dump.txt --tick-us 1000
+"""
+
+import argparse
+import string
+import struct
+import sys
+
+HEADER_FORMAT = "<4sBBH"
+HEADER_SIZE = struct.calcsize(HEADER_FORMAT)
+RECORD_FORMAT = "<BBHI"
+MAGIC = b"MTRC"
+END_FLAG = 0x80
+
+EVENT_NAMES = {
+    1: "menu_next",
+    2: "menu_prev",
+    3: "menu_enter",
+    4: "menu_esc",
+    5: "update_view",
+    16: "drv.screen_init",
+    17: "drv.cursor_position",
+    18: "drv.print_string",
+    19: "drv.print_char",
+    20: "drv.write_row",
+    21: "drv.fill",
+    22: "drv.print_flash_string",
+}
+DRIVER_EVENTS_FIRST_ID = 16
+
+
+def load_dump(path):
+    with open(path, "rb") as dump_file:
+        data = dump_file.read()
+    text = data.decode("ascii", errors="ignore")
+    if data and len(text) == len(data) and all(c in string.hexdigits or c.isspace() for c in text):
+        data = bytes.fromhex("".join(text.split()))
+    return data
+
+
+def parse_dump(data):
+    if len(data) < HEADER_SIZE:
+        raise ValueError("dump shorter than the header")
+    magic, version, record_size, records_qty = struct.unpack_from(HEADER_FORMAT, data)
+    if magic != MAGIC or version != 1:
+        raise ValueError("not a MENU_LIB trace dump (magic %r, version %d)" % (magic, version))
+    records = []
+    for i in range(records_qty):
+        offset = HEADER_SIZE + i * record_size
+        if offset + record_size > len(data):
+            raise ValueError("dump truncated after %d of %d records" % (i, records_qty))
+        records.append(struct.unpack_from(RECORD_FORMAT, data, offset))
+    return records
+
+
+def event_name(event):
+    base = event & ~END_FLAG
+    return EVENT_NAMES.get(base, "user_0x%02X" % base)
+
+
+def print_timeline(records, tick_us, out):
+    open_calls = []
+    previous_timestamp = records[0][3] if records else 0
+    out.write("%12s %10s  %s\n" % ("time_us", "delta_us", "event"))
+    for event, level, index, timestamp in records:
+        delta = (timestamp - previous_timestamp) & 0xFFFFFFFF
+        previous_timestamp = timestamp
+        time_us = timestamp * tick_us
+        name = event_name(event)
+        base = event & ~END_FLAG
+
+        if base >= DRIVER_EVENTS_FIRST_ID and base in EVENT_NAMES:
+            detail = "row=%d col/len=%d" % (level, index)
+            out.write("%12d %10d  %s%s %s\n" % (time_us, delta * tick_us, "  " * len(open_calls), name, detail))
+        elif event & END_FLAG:
+            start = open_calls.pop()[1] if open_calls and open_calls[-1][0] == base else timestamp
+            duration = ((timestamp - start) & 0xFFFFFFFF) * tick_us
+            out.write("%12d %10d  %s} %s level=%d index=%d took %d us\n"
+                      % (time_us, delta * tick_us, "  " * len(open_calls), name, level, index, duration))
+        elif base in EVENT_NAMES:
+            out.write("%12d %10d  %s%s level=%d index=%d {\n"
+                      % (time_us, delta * tick_us, "  " * len(open_calls), name, level, index))
+            open_calls.append((base, timestamp))
+        else:
+            out.write("%12d %10d  %s%s level=%d index=%d\n"
+                      % (time_us, delta * tick_us, "  " * len(open_calls), name, level, index))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode a MENU_LIB trace dump into a timeline.")
+    parser.add_argument("dump", help="binary or hex text dump written by menu_trace_dump()")
+    parser.add_argument("--tick-us", type=int, default=1, help="duration of one tick source unit in us (default 1)")
+    args = parser.parse_args()
+
+    try:
+        records = parse_dump(load_dump(args.dump))
+    except ValueError as error:
+        sys.stderr.write("menu_trace_decode: %s\n" % error)
+        return 1
+    print_timeline(records, args.tick_us, sys.stdout)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
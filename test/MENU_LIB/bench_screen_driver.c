@@ -0,0 +1,167 @@
+/**
+ * @file bench_screen_driver.c
+ * @author niwciu (niwciu@gmail.com)
+ * @brief Counting screen driver used by the host benchmark.
+ * @date 2025-11-20
+ *
+ * The driver keeps a screen copy so the compiler cannot drop the writes,
+ * and counts every call made by the menu engine.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include "menu_screen_driver_interface.h"
+#include "bench_screen_driver.h"
+#include <stddef.h>
+
+bench_driver_counters_t bench_driver_counters;
+
+static char bench_screen[BENCH_LCD_Y][BENCH_LCD_X];
+static uint8_t bench_cur_x;
+static uint8_t bench_cur_y;
+
+static void bench_screen_init(void);
+static uint8_t bench_get_number_of_screen_lines(void);
+static uint8_t bench_get_number_of_chars_per_line(void);
+static void bench_clr_scr(void);
+static void bench_write_row(uint8_t row, const char *buf, uint8_t len);
+static void bench_fill(uint8_t row, uint8_t column, char character, uint8_t len);
+static void bench_put_char(const char C);
+
+static const struct menu_screen_driver_interface_struct bench_screen_driver_interface = {
+    bench_screen_init,
+    bench_get_number_of_screen_lines,
+    bench_get_number_of_chars_per_line,
+    bench_clr_scr,
+    bench_cursor_position,
+    bench_print_string,
+    bench_print_char,
+    NULL,
+    NULL,
+    NULL,
+};
+
+static const struct menu_screen_driver_interface_struct bench_row_write_driver_interface = {
+    bench_screen_init,
+    bench_get_number_of_screen_lines,
+    bench_get_number_of_chars_per_line,
+    bench_clr_scr,
+    bench_cursor_position,
+    bench_print_string,
+    bench_print_char,
+    bench_write_row,
+    bench_fill,
+    NULL,
+};
+
+const struct menu_screen_driver_interface_struct *get_menu_display_driver_interface(void)
+{
+    return &bench_screen_driver_interface;
+}
+
+const struct menu_screen_driver_interface_struct *bench_get_row_write_driver_interface(void)
+{
+    return &bench_row_write_driver_interface;
+}
+
+void bench_reset_driver_counters(void)
+{
+    bench_driver_counters.cursor_position_calls = 0;
+    bench_driver_counters.print_string_calls = 0;
+    bench_driver_counters.print_char_calls = 0;
+    bench_driver_counters.write_row_calls = 0;
+    bench_driver_counters.fill_calls = 0;
+    bench_driver_counters.chars_emitted = 0;
+}
+
+uint32_t bench_driver_calls(void)
+{
+    return bench_driver_counters.cursor_position_calls +
+           bench_driver_counters.print_string_calls +
+           bench_driver_counters.print_char_calls +
+           bench_driver_counters.write_row_calls +
+           bench_driver_counters.fill_calls;
+}
+
+static void bench_screen_init(void)
+{
+    bench_clr_scr();
+}
+
+static uint8_t bench_get_number_of_screen_lines(void)
+{
+    return BENCH_LCD_Y;
+}
+
+static uint8_t bench_get_number_of_chars_per_line(void)
+{
+    return BENCH_LCD_X;
+}
+
+static void bench_clr_scr(void)
+{
+    for (uint8_t y = 0; y < BENCH_LCD_Y; y++)
+    {
+        for (uint8_t x = 0; x < BENCH_LCD_X; x++)
+        {
+            bench_screen[y][x] = ' ';
+        }
+    }
+    bench_cur_x = 0;
+    bench_cur_y = 0;
+}
+
+void bench_cursor_position(uint8_t row, uint8_t column)
+{
+    bench_driver_counters.cursor_position_calls++;
+    bench_cur_x = column;
+    bench_cur_y = row;
+}
+
+void bench_print_string(const char *str)
+{
+    bench_driver_counters.print_string_calls++;
+    while (*str != '\0')
+    {
+        bench_put_char(*str);
+        str++;
+    }
+}
+
+void bench_print_char(const char C)
+{
+    bench_driver_counters.print_char_calls++;
+    bench_put_char(C);
+}
+
+static void bench_write_row(uint8_t row, const char *buf, uint8_t len)
+{
+    bench_driver_counters.write_row_calls++;
+    bench_cur_x = 0;
+    bench_cur_y = row;
+    for (uint8_t i = 0; i < len; i++)
+    {
+        bench_put_char(buf[i]);
+    }
+}
+
+static void bench_fill(uint8_t row, uint8_t column, char character, uint8_t len)
+{
+    bench_driver_counters.fill_calls++;
+    bench_cur_x = column;
+    bench_cur_y = row;
+    for (uint8_t i = 0; i < len; i++)
+    {
+        bench_put_char(character);
+    }
+}
+
+static void bench_put_char(const char C)
+{
+    bench_driver_counters.chars_emitted++;
+    if ((bench_cur_y < BENCH_LCD_Y) && (bench_cur_x < BENCH_LCD_X))
+    {
+        bench_screen[bench_cur_y][bench_cur_x] = C;
+    }
+    bench_cur_x++;
+}
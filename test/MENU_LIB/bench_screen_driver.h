@@ -0,0 +1,38 @@
+/**
+ * @file bench_screen_driver.h
+ * @author niwciu (niwciu@gmail.com)
+ * @brief Counting screen driver used by the host benchmark.
+ * @date 2025-11-20
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#pragma once
+
+#include "menu_screen_driver_interface.h"
+#include <stdint.h>
+
+#define BENCH_LCD_X 20
+#define BENCH_LCD_Y 4
+
+typedef struct
+{
+    uint32_t cursor_position_calls;
+    uint32_t print_string_calls;
+    uint32_t print_char_calls;
+    uint32_t write_row_calls;
+    uint32_t fill_calls;
+    uint32_t chars_emitted;
+} bench_driver_counters_t;
+
+extern bench_driver_counters_t bench_driver_counters;
+
+const struct menu_screen_driver_interface_struct *bench_get_row_write_driver_interface(void);
+void bench_reset_driver_counters(void);
+uint32_t bench_driver_calls(void);
+
+/* Drawing functions, also bound directly by bench_static_driver.h */
+void bench_cursor_position(uint8_t row, uint8_t column);
+void bench_print_string(const char *str);
+void bench_print_char(const char C);
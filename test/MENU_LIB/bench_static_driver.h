@@ -0,0 +1,16 @@
+/**
+ * @file bench_static_driver.h
+ * @author niwciu (niwciu@gmail.com)
+ * @brief Compile-time binding of the per character bench driver (MENU_USE_STATIC_DRIVER).
+ * @date 2025-12-10
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include "bench_screen_driver.h"
+
+#define MENU_STATIC_DRV_CURSOR_POSITION(row, column) bench_cursor_position((row), (column))
+#define MENU_STATIC_DRV_PRINT_STRING(str) bench_print_string(str)
+#define MENU_STATIC_DRV_PRINT_CHAR(c) bench_print_char(c)
@@ -0,0 +1,48 @@
+/**
+ * @file menu.h
+ * @author niwciu (niwciu@gmail.com)
+ * @brief Menu configuration for the compact table unit tests.
+ * @version 1.0.0
+ * @date 2025-11-21
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#ifndef MENU_USE_COMPACT_TABLE
+#define MENU_USE_COMPACT_TABLE
+#endif
+
+#include "menu_lib_type.h"
+
+#define MAX_MENU_DEPTH 3
+
+typedef enum
+{
+    CB_STATUS_UNKNOWN,
+    CB_EXECUTED,
+} mock_cb_status_e;
+
+/* Node indices of mock_menu_table */
+enum
+{
+    MOCK_MENU_1,
+    MOCK_MENU_2,
+    MOCK_MENU_3,
+    MOCK_MENU_4,
+    MOCK_MENU_5,
+    MOCK_SUB_MENU_1_1,
+    MOCK_SUB_MENU_1_2,
+    MOCK_SUB_MENU_2_1,
+    MOCK_SUB_MENU_2_1_1,
+};
+
+extern mock_cb_status_e mock_menu_callback_status;
+
+extern const menu_table_t mock_menu_table;
+extern const menu_table_t mock_too_deep_menu_table;
+extern const menu_table_t mock_broken_link_menu_table;
+extern const menu_table_t mock_empty_menu_table;
+
+void mock_set_callback_status_to_unknown(void);
@@ -0,0 +1,161 @@
+#include "unity/fixture/unity_fixture.h"
+#include "menu_lib.h"
+#include "menu_screen_driver_interface.h"
+#include "mock_menu_screen_driver_interface.h"
+#include <stddef.h>
+
+TEST_GROUP(menu_lib_compact_table);
+
+TEST_SETUP(menu_lib_compact_table)
+{
+    /* Init before every test */
+    init_mock_screen_driver();
+    menu_init();
+}
+
+TEST_TEAR_DOWN(menu_lib_compact_table)
+{
+    /* Cleanup after every test */
+}
+
+TEST(menu_lib_compact_table, WhenMenuViewInitWithNullMenuTableThenReturnNoMenu)
+{
+    TEST_ASSERT_EQUAL(MENU_ERR_NO_MENU, menu_view_init(NULL, NULL, NULL));
+}
+
+TEST(menu_lib_compact_table, WhenMenuViewInitWithEmptyMenuTableThenReturnNoMenu)
+{
+    TEST_ASSERT_EQUAL(MENU_ERR_NO_MENU, menu_view_init(&mock_empty_menu_table, NULL, NULL));
+}
+
+TEST(menu_lib_compact_table, WhenMenuViewInitWithTooDeepMenuTableThenReturnMenuTooDeep)
+{
+    TEST_ASSERT_EQUAL(MENU_ERR_MENU_TOO_DEEP, menu_view_init(&mock_too_deep_menu_table, NULL, NULL));
+}
+
+TEST(menu_lib_compact_table, WhenMenuViewInitWithMenuTableLinkingNodeOutOfTableThenReturnMalformedMenu)
+{
+    TEST_ASSERT_EQUAL(MENU_ERR_MALFORMED_MENU, menu_view_init(&mock_broken_link_menu_table, NULL, NULL));
+}
+
+TEST(menu_lib_compact_table, WhenMenuViewInitWithMockMenuTableThenReturnOkAndScreenContentIsEqualToExpected)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        ">menu_1             ",
+        " menu_2             ",
+        " menu_3             "};
+    // When
+    menu_status_t status = menu_view_init(&mock_menu_table, NULL, NULL);
+    // Then
+    TEST_ASSERT_EQUAL(MENU_OK, status);
+    TEST_ASSERT_EQUAL(MOCK_MENU_1, get_current_menu_position());
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_compact_table, GivenMenuViewInitWithMockMenuTableWhenMenuNextCalled10TimesThenLastItemSelectedAndScreenContentIsEqualToExpected)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        " menu_3             ",
+        " menu_4             ",
+        ">menu_5             "};
+    // Given
+    menu_view_init(&mock_menu_table, NULL, NULL);
+    // When
+    for (uint8_t i = 0U; i < 10U; i++)
+    {
+        menu_next();
+    }
+    // Then
+    TEST_ASSERT_EQUAL(MOCK_MENU_5, get_current_menu_position());
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_compact_table, GivenMenuNextCalled4TimesWhenMenuPrevCalled3TimesThenScreenContentIsEqualToExpected)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        ">menu_2             ",
+        " menu_3             ",
+        " menu_4             "};
+    // Given
+    menu_view_init(&mock_menu_table, NULL, NULL);
+    for (uint8_t i = 0U; i < 4U; i++)
+    {
+        menu_next();
+    }
+    // When
+    for (uint8_t i = 0U; i < 3U; i++)
+    {
+        menu_prev();
+    }
+    // Then
+    TEST_ASSERT_EQUAL(MOCK_MENU_2, get_current_menu_position());
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_compact_table, GivenMenuNextCalledWhenMenuEnterCalledTwiceThenSubMenuHeaderShowsParentNameAndScreenContentIsEqualToExpected)
+{
+    const char *expected_screen[4] = {
+        "----- menu_2_1 -----",
+        ">menu_2_1_1         ",
+        "                    ",
+        "                    "};
+    // Given
+    menu_view_init(&mock_menu_table, NULL, NULL);
+    menu_next();
+    // When
+    menu_enter();
+    menu_enter();
+    // Then
+    TEST_ASSERT_EQUAL(MOCK_SUB_MENU_2_1_1, get_current_menu_position());
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_compact_table, GivenMenuNextCalledAndMenuEnterCalledTwiceWhenMenuEscCalledTwiceThenScreenContentIsEqualToExpected)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        " menu_1             ",
+        ">menu_2             ",
+        " menu_3             "};
+    // Given
+    menu_view_init(&mock_menu_table, NULL, NULL);
+    menu_next();
+    menu_enter();
+    menu_enter();
+    // When
+    menu_esc();
+    menu_esc();
+    // Then
+    TEST_ASSERT_EQUAL(MOCK_MENU_2, get_current_menu_position());
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_compact_table, GivenSubMenu1_2SelectedWhenMenuEnterCalledThenItemCallbackExecuted)
+{
+    // Given
+    menu_view_init(&mock_menu_table, NULL, NULL);
+    menu_enter();
+    menu_next();
+    mock_set_callback_status_to_unknown();
+    // When
+    menu_enter();
+    // Then
+    TEST_ASSERT_EQUAL(MOCK_SUB_MENU_1_2, get_current_menu_position());
+    TEST_ASSERT_EQUAL(CB_EXECUTED, mock_menu_callback_status);
+}
+
+TEST(menu_lib_compact_table, GivenSubMenu1_1WithoutCallbackSelectedWhenMenuEnterCalledThenCallbackNotExecuted)
+{
+    // Given
+    menu_view_init(&mock_menu_table, NULL, NULL);
+    menu_enter();
+    mock_set_callback_status_to_unknown();
+    // When
+    menu_enter();
+    // Then
+    TEST_ASSERT_EQUAL(MOCK_SUB_MENU_1_1, get_current_menu_position());
+    TEST_ASSERT_EQUAL(CB_STATUS_UNKNOWN, mock_menu_callback_status);
+}
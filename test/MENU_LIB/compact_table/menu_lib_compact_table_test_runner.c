@@ -0,0 +1,19 @@
+#include "unity/fixture/unity_fixture.h"
+
+TEST_GROUP_RUNNER(menu_lib_compact_table)
+{
+    /* Compact table view init Test cases to run */
+    RUN_TEST_CASE(menu_lib_compact_table, WhenMenuViewInitWithNullMenuTableThenReturnNoMenu);
+    RUN_TEST_CASE(menu_lib_compact_table, WhenMenuViewInitWithEmptyMenuTableThenReturnNoMenu);
+    RUN_TEST_CASE(menu_lib_compact_table, WhenMenuViewInitWithTooDeepMenuTableThenReturnMenuTooDeep);
+    RUN_TEST_CASE(menu_lib_compact_table, WhenMenuViewInitWithMenuTableLinkingNodeOutOfTableThenReturnMalformedMenu);
+    RUN_TEST_CASE(menu_lib_compact_table, WhenMenuViewInitWithMockMenuTableThenReturnOkAndScreenContentIsEqualToExpected);
+    /* Compact table navigation Test cases to run */
+    RUN_TEST_CASE(menu_lib_compact_table, GivenMenuViewInitWithMockMenuTableWhenMenuNextCalled10TimesThenLastItemSelectedAndScreenContentIsEqualToExpected);
+    RUN_TEST_CASE(menu_lib_compact_table, GivenMenuNextCalled4TimesWhenMenuPrevCalled3TimesThenScreenContentIsEqualToExpected);
+    RUN_TEST_CASE(menu_lib_compact_table, GivenMenuNextCalledWhenMenuEnterCalledTwiceThenSubMenuHeaderShowsParentNameAndScreenContentIsEqualToExpected);
+    RUN_TEST_CASE(menu_lib_compact_table, GivenMenuNextCalledAndMenuEnterCalledTwiceWhenMenuEscCalledTwiceThenScreenContentIsEqualToExpected);
+    /* Compact table callback execution Test cases to run */
+    RUN_TEST_CASE(menu_lib_compact_table, GivenSubMenu1_2SelectedWhenMenuEnterCalledThenItemCallbackExecuted);
+    RUN_TEST_CASE(menu_lib_compact_table, GivenSubMenu1_1WithoutCallbackSelectedWhenMenuEnterCalledThenCallbackNotExecuted);
+}
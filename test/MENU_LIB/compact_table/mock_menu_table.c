@@ -0,0 +1,111 @@
+/**
+ * @file mock_menu_table.c
+ * @author niwciu (niwciu@gmail.com)
+ * @brief Compact menu tables used by the compact table unit tests.
+ * @version 1.0.0
+ * @date 2025-11-21
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include "menu.h"
+
+#include <stddef.h>
+
+#define N MENU_NO_NODE
+#define NC MENU_NO_CALLBACK
+
+mock_cb_status_e mock_menu_callback_status = CB_STATUS_UNKNOWN;
+
+static void mock_menu_callback(void);
+
+/* Name offsets in mock_menu_names */
+enum
+{
+    NAME_MENU_1 = 0,
+    NAME_MENU_2 = 7,
+    NAME_MENU_3 = 14,
+    NAME_MENU_4 = 21,
+    NAME_MENU_5 = 28,
+    NAME_MENU_1_1 = 35,
+    NAME_MENU_1_2 = 44,
+    NAME_MENU_2_1 = 53,
+    NAME_MENU_2_1_1 = 62,
+};
+
+static const char mock_menu_names[] =
+    "menu_1\0menu_2\0menu_3\0menu_4\0menu_5\0"
+    "menu_1_1\0menu_1_2\0menu_2_1\0menu_2_1_1";
+
+static const menu_callback_t mock_menu_callbacks[] = {mock_menu_callback};
+
+static const menu_node_t mock_menu_nodes[] = {
+    /* name_offset, next, prev, child, parent, callback_id */
+    [MOCK_MENU_1] = {NAME_MENU_1, MOCK_MENU_2, N, MOCK_SUB_MENU_1_1, N, NC},
+    [MOCK_MENU_2] = {NAME_MENU_2, MOCK_MENU_3, MOCK_MENU_1, MOCK_SUB_MENU_2_1, N, NC},
+    [MOCK_MENU_3] = {NAME_MENU_3, MOCK_MENU_4, MOCK_MENU_2, N, N, NC},
+    [MOCK_MENU_4] = {NAME_MENU_4, MOCK_MENU_5, MOCK_MENU_3, N, N, NC},
+    [MOCK_MENU_5] = {NAME_MENU_5, N, MOCK_MENU_4, N, N, 0U},
+    [MOCK_SUB_MENU_1_1] = {NAME_MENU_1_1, MOCK_SUB_MENU_1_2, N, N, MOCK_MENU_1, NC},
+    [MOCK_SUB_MENU_1_2] = {NAME_MENU_1_2, N, MOCK_SUB_MENU_1_1, N, MOCK_MENU_1, 0U},
+    [MOCK_SUB_MENU_2_1] = {NAME_MENU_2_1, N, N, MOCK_SUB_MENU_2_1_1, MOCK_MENU_2, NC},
+    [MOCK_SUB_MENU_2_1_1] = {NAME_MENU_2_1_1, N, N, N, MOCK_SUB_MENU_2_1, 0U},
+};
+
+const menu_table_t mock_menu_table = {
+    mock_menu_nodes,
+    mock_menu_names,
+    mock_menu_callbacks,
+    (menu_index_t)(sizeof(mock_menu_nodes) / sizeof(mock_menu_nodes[0])),
+    0U,
+};
+
+static const char mock_too_deep_menu_names[] = "level";
+
+static const menu_node_t mock_too_deep_menu_nodes[] = {
+    {0U, N, N, 1U, N, NC},
+    {0U, N, N, 2U, 0U, NC},
+    {0U, N, N, 3U, 1U, NC},
+    {0U, N, N, N, 2U, NC},
+};
+
+const menu_table_t mock_too_deep_menu_table = {
+    mock_too_deep_menu_nodes,
+    mock_too_deep_menu_names,
+    NULL,
+    (menu_index_t)(sizeof(mock_too_deep_menu_nodes) / sizeof(mock_too_deep_menu_nodes[0])),
+    0U,
+};
+
+static const char mock_broken_link_menu_names[] = "item";
+
+static const menu_node_t mock_broken_link_menu_nodes[] = {
+    {0U, 1U, N, N, N, NC},
+    {0U, 7U, 0U, N, N, NC},
+};
+
+const menu_table_t mock_broken_link_menu_table = {
+    mock_broken_link_menu_nodes,
+    mock_broken_link_menu_names,
+    NULL,
+    (menu_index_t)(sizeof(mock_broken_link_menu_nodes) / sizeof(mock_broken_link_menu_nodes[0])),
+    0U,
+};
+
+const menu_table_t mock_empty_menu_table = {
+    mock_menu_nodes,
+    mock_menu_names,
+    mock_menu_callbacks,
+    0U,
+    0U,
+};
+
+void mock_set_callback_status_to_unknown(void)
+{
+    mock_menu_callback_status = CB_STATUS_UNKNOWN;
+}
+
+static void mock_menu_callback(void)
+{
+    mock_menu_callback_status = CB_EXECUTED;
+}
@@ -10,6 +10,41 @@
 #TARGETS FOR RUNNING UNIT TESTS
 message(STATUS "To run Unit Tests, you can use predefine target: \r\n\trun,")
 add_custom_target(run MENU_LIB_test)
+message(STATUS "To run Unit Tests of the compact menu table format, you can use predefine target: \r\n\trun_compact_table,")
+add_custom_target(run_compact_table MENU_LIB_compact_table_test)
+message(STATUS "To run Unit Tests of the shadow buffer build mode, you can use predefine target: \r\n\trun_shadow_buffer,")
+add_custom_target(run_shadow_buffer MENU_LIB_shadow_buffer_test)
+message(STATUS "To run Unit Tests of the virtual list build mode, you can use predefine target: \r\n\trun_virtual_list,")
+add_custom_target(run_virtual_list MENU_LIB_virtual_list_test)
+message(STATUS "To run Unit Tests of the trace build mode, you can use predefine target: \r\n\trun_trace,")
+add_custom_target(run_trace MENU_LIB_trace_test)
+message(STATUS "To run Unit Tests of the compile-time menu definition (menu_lib.hpp), you can use predefine target: \r\n\trun_menu_dsl,")
+add_custom_target(run_menu_dsl MENU_LIB_menu_dsl_test)
+message(STATUS "To run Unit Tests of the static driver binding build mode, you can use predefine target: \r\n\trun_static_driver,")
+add_custom_target(run_static_driver MENU_LIB_static_driver_test)
+message(STATUS "To run Unit Tests of the slim node build mode, you can use predefine target: \r\n\trun_slim_nodes,")
+add_custom_target(run_slim_nodes MENU_LIB_slim_nodes_test)
+message(STATUS "To run Unit Tests of the program memory strings build mode, you can use predefine target: \r\n\trun_flash_strings,")
+add_custom_target(run_flash_strings MENU_LIB_flash_strings_test)
+
+#TARGET FOR RUNNING HOST BENCHMARK
+message(STATUS "To run host benchmark, you can use predefine target: \r\n\tbench,")
+add_custom_target(bench menu_lib_bench)
+
+#TARGET FOR COMPARING DRIVER BINDING MODES (TIME PER OPERATION AND ENGINE CODE SIZE)
+message(STATUS "To compare interface pointer and static driver binding, you can use predefine target: \r\n\tbench_binding,")
+add_custom_target(bench_binding
+    COMMAND menu_lib_bench_binding_pointer
+    COMMAND menu_lib_bench_binding_static
+    COMMAND size $<TARGET_FILE:menu_lib_bench_core> $<TARGET_FILE:menu_lib_bench_static_core>
+    DEPENDS menu_lib_bench_binding_pointer menu_lib_bench_binding_static
+)
+
+#TARGET FOR RUNNING INPUT TO DISPLAY LATENCY HARNESS
+message(STATUS "To run Unit Tests of the buffered HD44780 flush planner, you can use predefine target: \r\n\trun_lcd_flush,")
+add_custom_target(run_lcd_flush MENU_LIB_lcd_flush_test)
+message(STATUS "To run input to display latency harness, you can use predefine target: \r\n\tlatency,")
+add_custom_target(latency menu_lib_latency)
 
 # TARGET FOR CHECKING CODE COMPLEXITY METRICS"
 # check if lizard software is available 
@@ -0,0 +1,52 @@
+/**
+ * @file fake_flash.c
+ * @author niwciu (niwciu@gmail.com)
+ * @brief Fake program memory accessor for the MENU_USE_FLASH_STRINGS unit tests.
+ * @date 2025-12-12
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include "fake_flash.h"
+#include <stddef.h>
+
+/* Section bounds provided by the GNU linker */
+extern const char __start_menu_fake_flash[];
+extern const char __stop_menu_fake_flash[];
+
+uint32_t fake_flash_reads;
+uint32_t fake_flash_invalid_reads;
+
+void fake_flash_reset_counters(void)
+{
+    fake_flash_reads = 0U;
+    fake_flash_invalid_reads = 0U;
+}
+
+bool fake_flash_contains(const char *address)
+{
+    return (address >= __start_menu_fake_flash) && (address < __stop_menu_fake_flash);
+}
+
+/**
+ * @brief Read one byte of the fake program memory.
+ *
+ * @param address Address in the menu_fake_flash section.
+ * @return char Stored byte, '\0' for addresses outside of the section.
+ */
+char fake_flash_read_char(const char *address)
+{
+    char c = '\0';
+
+    if (fake_flash_contains(address))
+    {
+        c = *address;
+        fake_flash_reads++;
+    }
+    else
+    {
+        fake_flash_invalid_reads++;
+    }
+
+    return c;
+}
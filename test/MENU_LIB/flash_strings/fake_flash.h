@@ -0,0 +1,32 @@
+/**
+ * @file fake_flash.h
+ * @author niwciu (niwciu@gmail.com)
+ * @brief Fake program memory address space for the MENU_USE_FLASH_STRINGS unit tests.
+ * @date 2025-12-12
+ *
+ * Used as MENU_FLASH_ACCESS_HEADER. Strings declared with FAKE_FLASH (test
+ * menu names, headers and the strings of the engine itself) are placed in
+ * the menu_fake_flash section. The engine reads them through
+ * fake_flash_read_char(), which counts the reads and rejects addresses
+ * outside of the section, like pgm_read_byte() reading a RAM address would
+ * return unrelated data on AVR.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define FAKE_FLASH __attribute__((section("menu_fake_flash")))
+
+#define MENU_FLASH_ATTR FAKE_FLASH
+#define MENU_FLASH_READ_CHAR(ptr) fake_flash_read_char(ptr)
+
+extern uint32_t fake_flash_reads;
+extern uint32_t fake_flash_invalid_reads;
+
+void fake_flash_reset_counters(void);
+bool fake_flash_contains(const char *address);
+char fake_flash_read_char(const char *address);
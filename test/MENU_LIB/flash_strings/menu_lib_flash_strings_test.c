@@ -0,0 +1,162 @@
+#include "unity/fixture/unity_fixture.h"
+#include "menu_lib.h"
+#include "mock_menu_screen_driver_interface.h"
+#include "mock_flash_menu.h"
+#include "fake_flash.h"
+#include <stddef.h>
+
+static menu_ctx_t flash_ctx;
+static struct menu_screen_driver_interface_struct flash_driver_interface;
+static uint16_t print_flash_string_call_counter;
+static uint16_t flash_address_passed_to_print_string_qty;
+
+static void prepare_flash_driver_interface(void);
+static void checked_print_string(const char *str);
+static void mock_print_flash_string(const char *flash_str);
+
+TEST_GROUP(menu_lib_flash_strings);
+
+TEST_SETUP(menu_lib_flash_strings)
+{
+    /* Init before every test */
+    init_mock_screen_driver();
+    prepare_flash_driver_interface();
+    print_flash_string_call_counter = 0U;
+    flash_address_passed_to_print_string_qty = 0U;
+    fake_flash_reset_counters();
+}
+
+TEST_TEAR_DOWN(menu_lib_flash_strings)
+{
+    /* Cleanup after every test */
+}
+
+TEST(menu_lib_flash_strings, WhenMenuCtxViewInitThenNamesAndDefaultHeaderAreReadFromFlash)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        ">Settings           ",
+        " About              ",
+        " NO NAME            "};
+    // Given
+    menu_ctx_init(&flash_ctx, &flash_driver_interface);
+    // When
+    menu_ctx_view_init(&flash_ctx, &flash_menu_1, NULL, NULL);
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+    TEST_ASSERT_TRUE(print_flash_string_call_counter > 0U);
+    TEST_ASSERT_TRUE(fake_flash_reads > 0U);
+    TEST_ASSERT_EQUAL(0, fake_flash_invalid_reads);
+    TEST_ASSERT_EQUAL(0, flash_address_passed_to_print_string_qty);
+}
+
+TEST(menu_lib_flash_strings, GivenCustomFlashHeaderWhenMenuCtxViewInitThenHeaderIsCenteredOnScreen)
+{
+    const char *expected_screen[4] = {
+        "-----FLASH MENU-----",
+        ">Settings           ",
+        " About              ",
+        " NO NAME            "};
+    // Given
+    menu_ctx_init(&flash_ctx, &flash_driver_interface);
+    // When
+    menu_ctx_view_init(&flash_ctx, &flash_menu_1, NULL, flash_menu_header);
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+    TEST_ASSERT_EQUAL(0, fake_flash_invalid_reads);
+}
+
+TEST(menu_lib_flash_strings, GivenMenuCtxViewInitWhenMenuCtxEnterCalledThenSubmenuHeaderIsParentNameFromFlash)
+{
+    const char *expected_screen[4] = {
+        "----- Settings -----",
+        ">Contrast           ",
+        " Backlight          ",
+        "                    "};
+    // Given
+    menu_ctx_init(&flash_ctx, &flash_driver_interface);
+    menu_ctx_view_init(&flash_ctx, &flash_menu_1, NULL, NULL);
+    // When
+    menu_ctx_enter(&flash_ctx);
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+    TEST_ASSERT_EQUAL(0, fake_flash_invalid_reads);
+    TEST_ASSERT_EQUAL(0, flash_address_passed_to_print_string_qty);
+}
+
+TEST(menu_lib_flash_strings, GivenDriverWithoutPrintFlashStringWhenMenuCtxViewInitThenNamesArePrintedCharByChar)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        ">Settings           ",
+        " About              ",
+        " NO NAME            "};
+    // Given
+    flash_driver_interface.print_flash_string = NULL;
+    menu_ctx_init(&flash_ctx, &flash_driver_interface);
+    mock_reset_driver_call_counters();
+    // When
+    menu_ctx_view_init(&flash_ctx, &flash_menu_1, NULL, NULL);
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+    TEST_ASSERT_EQUAL(0, print_flash_string_call_counter);
+    TEST_ASSERT_TRUE(mock_print_char_call_counter >= (sizeof("Settings") + sizeof("About") + sizeof("NO NAME") - 3U));
+    TEST_ASSERT_EQUAL(0, fake_flash_invalid_reads);
+    TEST_ASSERT_EQUAL(0, flash_address_passed_to_print_string_qty);
+}
+
+TEST(menu_lib_flash_strings, GivenRowDriverWhenMenuCtxViewInitThenRowsAreComposedFromFlashNames)
+{
+    const char *expected_screen[4] = {
+        "-----FLASH MENU-----",
+        ">Settings           ",
+        " About              ",
+        " NO NAME            "};
+    // Given
+    init_mock_row_screen_driver();
+    prepare_flash_driver_interface();
+    menu_ctx_init(&flash_ctx, &flash_driver_interface);
+    mock_reset_driver_call_counters();
+    // When
+    menu_ctx_view_init(&flash_ctx, &flash_menu_1, NULL, flash_menu_header);
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+    TEST_ASSERT_EQUAL(LCD_Y, mock_write_row_call_counter);
+    TEST_ASSERT_EQUAL(0, print_flash_string_call_counter);
+    TEST_ASSERT_TRUE(fake_flash_reads > 0U);
+    TEST_ASSERT_EQUAL(0, fake_flash_invalid_reads);
+}
+
+/**
+ * @brief Copy the selected mock driver and route strings through the address space checks.
+ */
+static void prepare_flash_driver_interface(void)
+{
+    flash_driver_interface = *get_menu_display_driver_interface();
+    flash_driver_interface.print_string = checked_print_string;
+    flash_driver_interface.print_flash_string = mock_print_flash_string;
+}
+
+static void checked_print_string(const char *str)
+{
+    if (fake_flash_contains(str))
+    {
+        flash_address_passed_to_print_string_qty++;
+    }
+    mock_print_string(str);
+}
+
+static void mock_print_flash_string(const char *flash_str)
+{
+    char ram_str[LCD_X + 1U];
+    uint8_t len = 0U;
+
+    print_flash_string_call_counter++;
+    for (char c = fake_flash_read_char(flash_str); (c != '\0') && (len < LCD_X); c = fake_flash_read_char(&flash_str[len]))
+    {
+        ram_str[len] = c;
+        len++;
+    }
+    ram_str[len] = '\0';
+    mock_print_string(ram_str);
+}
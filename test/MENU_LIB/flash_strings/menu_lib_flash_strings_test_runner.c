@@ -0,0 +1,11 @@
+#include "unity/fixture/unity_fixture.h"
+
+TEST_GROUP_RUNNER(menu_lib_flash_strings)
+{
+    /* Program memory names and headers Test cases to run */
+    RUN_TEST_CASE(menu_lib_flash_strings, WhenMenuCtxViewInitThenNamesAndDefaultHeaderAreReadFromFlash);
+    RUN_TEST_CASE(menu_lib_flash_strings, GivenCustomFlashHeaderWhenMenuCtxViewInitThenHeaderIsCenteredOnScreen);
+    RUN_TEST_CASE(menu_lib_flash_strings, GivenMenuCtxViewInitWhenMenuCtxEnterCalledThenSubmenuHeaderIsParentNameFromFlash);
+    RUN_TEST_CASE(menu_lib_flash_strings, GivenDriverWithoutPrintFlashStringWhenMenuCtxViewInitThenNamesArePrintedCharByChar);
+    RUN_TEST_CASE(menu_lib_flash_strings, GivenRowDriverWhenMenuCtxViewInitThenRowsAreComposedFromFlashNames);
+}
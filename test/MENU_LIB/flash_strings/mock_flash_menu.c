@@ -0,0 +1,27 @@
+/**
+ * @file mock_flash_menu.c
+ * @author niwciu (niwciu@gmail.com)
+ * @brief Menu with names in the fake program memory.
+ * @date 2025-12-12
+ *
+ * flash_menu_3 has no name to check the engine fallback text.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include "mock_flash_menu.h"
+#include "fake_flash.h"
+#include <stddef.h>
+
+const char flash_menu_header[] FAKE_FLASH = "FLASH MENU";
+
+static const char flash_menu_1_name[] FAKE_FLASH = "Settings";
+static const char flash_menu_1_1_name[] FAKE_FLASH = "Contrast";
+static const char flash_menu_1_2_name[] FAKE_FLASH = "Backlight";
+static const char flash_menu_2_name[] FAKE_FLASH = "About";
+
+const menu_t flash_menu_1 = {flash_menu_1_name, &flash_menu_2, NULL, &flash_menu_1_1, NULL, NULL};
+const menu_t flash_menu_1_1 = {flash_menu_1_1_name, &flash_menu_1_2, NULL, NULL, &flash_menu_1, NULL};
+const menu_t flash_menu_1_2 = {flash_menu_1_2_name, NULL, &flash_menu_1_1, NULL, &flash_menu_1, NULL};
+const menu_t flash_menu_2 = {flash_menu_2_name, &flash_menu_3, &flash_menu_1, NULL, NULL, NULL};
+const menu_t flash_menu_3 = {NULL, NULL, &flash_menu_2, NULL, NULL, NULL};
@@ -0,0 +1,20 @@
+/**
+ * @file mock_flash_menu.h
+ * @author niwciu (niwciu@gmail.com)
+ * @brief Menu with names in the fake program memory.
+ * @date 2025-12-12
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include "menu_lib_type.h"
+
+extern const char flash_menu_header[];
+
+extern const menu_t flash_menu_1;
+extern const menu_t flash_menu_1_1;
+extern const menu_t flash_menu_1_2;
+extern const menu_t flash_menu_2;
+extern const menu_t flash_menu_3;
@@ -0,0 +1,273 @@
+/**
+ * @file fake_lcd_io.c
+ * @author niwciu (niwciu@gmail.com)
+ * @brief HD44780 timing model behind a fake LCD_IO_driver_interface_struct.
+ * @date 2025-12-04
+ *
+ * A data byte is committed (the glyph is visible) when the controller has
+ * finished executing it, i.e. FAKE_LCD_DATA_WRITE_NS after the falling edge
+ * of E that latched its low nibble.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include "lcd_hd44780_GPIO_interface.h"
+#include "fake_lcd_io.h"
+#include <stdbool.h>
+#include <string.h>
+
+#define BUSY_FLAG_NIBBLE 0x08U
+#define CMD_CLEAR 0x01U
+#define CMD_HOME_MASK 0xFEU
+#define CMD_HOME 0x02U
+#define CMD_SET_DDRAM 0x80U
+#define FUNCTION_SET_4BIT_NIBBLE 0x02U
+
+uint64_t fake_lcd_now_ns;
+uint64_t fake_lcd_last_glyph_commit_ns;
+uint32_t fake_lcd_data_writes;
+uint32_t fake_lcd_busy_violations;
+uint32_t fake_lcd_cmd_writes;
+uint32_t fake_lcd_write_e_strobes;
+uint32_t fake_lcd_read_e_strobes;
+uint32_t fake_lcd_pin_writes;
+char fake_lcd_ddram[128];
+
+static uint64_t busy_until_ns;
+static bool pin_rs;
+static bool pin_rw;
+static uint8_t data_out;
+static bool four_bit_mode;
+static bool low_nibble_phase;
+static uint8_t high_nibble;
+static bool read_low_nibble_phase;
+static uint8_t address_counter;
+
+static void fake_init_pins(void);
+static void fake_set_data_pins_as_outputs(void);
+static void fake_set_data_pins_as_inputs(void);
+static void fake_write_data(uint8_t data);
+static uint8_t fake_read_data(void);
+static void fake_delay_us(uint32_t delay_us);
+static void fake_set_e(void);
+static void fake_reset_e(void);
+static void fake_set_rs(void);
+static void fake_reset_rs(void);
+static void fake_set_rw(void);
+static void fake_reset_rw(void);
+static void fake_set_bckl(void);
+static void fake_reset_bckl(void);
+static void gpio_op(void);
+static void pin_write(void);
+static void latch_nibble(uint8_t nibble);
+static void execute_byte(uint8_t byte);
+static void execute_cmd(uint8_t cmd);
+
+static const struct LCD_IO_driver_interface_struct fake_lcd_io_interface = {
+    fake_init_pins,
+    fake_set_data_pins_as_outputs,
+    fake_set_data_pins_as_inputs,
+    fake_write_data,
+    fake_read_data,
+    fake_delay_us,
+    fake_set_e,
+    fake_reset_e,
+    fake_set_rs,
+    fake_reset_rs,
+    fake_set_rw,
+    fake_reset_rw,
+    fake_set_bckl,
+    fake_reset_bckl,
+};
+
+const struct LCD_IO_driver_interface_struct *LCD_IO_driver_interface_get(void)
+{
+    return &fake_lcd_io_interface;
+}
+
+uint32_t fake_lcd_get_time_us(void)
+{
+    return (uint32_t)(fake_lcd_now_ns / 1000U);
+}
+
+static void fake_init_pins(void)
+{
+    gpio_op();
+    four_bit_mode = false;
+    low_nibble_phase = false;
+    read_low_nibble_phase = false;
+    address_counter = 0U;
+    busy_until_ns = 0U;
+    memset(fake_lcd_ddram, ' ', sizeof(fake_lcd_ddram));
+}
+
+static void fake_set_data_pins_as_outputs(void)
+{
+    gpio_op();
+}
+
+static void fake_set_data_pins_as_inputs(void)
+{
+    gpio_op();
+}
+
+static void fake_write_data(uint8_t data)
+{
+    pin_write();
+    data_out = data & 0x0FU;
+}
+
+static uint8_t fake_read_data(void)
+{
+    uint8_t nibble;
+
+    gpio_op();
+    if (read_low_nibble_phase)
+    {
+        nibble = address_counter & 0x0FU;
+    }
+    else
+    {
+        nibble = (uint8_t)((address_counter >> 4) & 0x07U);
+        if (fake_lcd_now_ns < busy_until_ns)
+        {
+            nibble |= BUSY_FLAG_NIBBLE;
+        }
+    }
+    return nibble;
+}
+
+static void fake_delay_us(uint32_t delay_us)
+{
+    fake_lcd_now_ns += (uint64_t)delay_us * 1000U;
+}
+
+static void fake_set_e(void)
+{
+    pin_write();
+}
+
+static void fake_reset_e(void)
+{
+    pin_write();
+    if (pin_rw)
+    {
+        read_low_nibble_phase = !read_low_nibble_phase;
+        fake_lcd_read_e_strobes++;
+    }
+    else
+    {
+        latch_nibble(data_out);
+        fake_lcd_write_e_strobes++;
+    }
+}
+
+static void fake_set_rs(void)
+{
+    pin_write();
+    pin_rs = true;
+}
+
+static void fake_reset_rs(void)
+{
+    pin_write();
+    pin_rs = false;
+}
+
+static void fake_set_rw(void)
+{
+    pin_write();
+    pin_rw = true;
+    read_low_nibble_phase = false;
+}
+
+static void fake_reset_rw(void)
+{
+    pin_write();
+    pin_rw = false;
+}
+
+static void fake_set_bckl(void)
+{
+    gpio_op();
+}
+
+static void fake_reset_bckl(void)
+{
+    gpio_op();
+}
+
+static void gpio_op(void)
+{
+    fake_lcd_now_ns += FAKE_LCD_GPIO_OP_NS;
+}
+
+static void pin_write(void)
+{
+    gpio_op();
+    fake_lcd_pin_writes++;
+}
+
+static void latch_nibble(uint8_t nibble)
+{
+    if (!four_bit_mode)
+    {
+        /* 8-bit mode after power up, only the upper data lines are connected */
+        four_bit_mode = (nibble == FUNCTION_SET_4BIT_NIBBLE);
+        busy_until_ns = fake_lcd_now_ns + FAKE_LCD_EXEC_NS;
+    }
+    else if (!low_nibble_phase)
+    {
+        high_nibble = nibble;
+        low_nibble_phase = true;
+    }
+    else
+    {
+        low_nibble_phase = false;
+        execute_byte((uint8_t)((high_nibble << 4) | nibble));
+    }
+}
+
+static void execute_byte(uint8_t byte)
+{
+    if (fake_lcd_now_ns < busy_until_ns)
+    {
+        fake_lcd_busy_violations++;
+    }
+    if (pin_rs)
+    {
+        fake_lcd_ddram[address_counter & 0x7FU] = (char)byte;
+        address_counter = (address_counter + 1U) & 0x7FU;
+        busy_until_ns = fake_lcd_now_ns + FAKE_LCD_DATA_WRITE_NS;
+        fake_lcd_last_glyph_commit_ns = busy_until_ns;
+        fake_lcd_data_writes++;
+    }
+    else
+    {
+        execute_cmd(byte);
+        fake_lcd_cmd_writes++;
+    }
+}
+
+static void execute_cmd(uint8_t cmd)
+{
+    if (cmd == CMD_CLEAR)
+    {
+        memset(fake_lcd_ddram, ' ', sizeof(fake_lcd_ddram));
+        address_counter = 0U;
+        busy_until_ns = fake_lcd_now_ns + FAKE_LCD_CLEAR_HOME_NS;
+    }
+    else if ((cmd & CMD_HOME_MASK) == CMD_HOME)
+    {
+        address_counter = 0U;
+        busy_until_ns = fake_lcd_now_ns + FAKE_LCD_CLEAR_HOME_NS;
+    }
+    else
+    {
+        if ((cmd & CMD_SET_DDRAM) != 0U)
+        {
+            address_counter = cmd & 0x7FU;
+        }
+        busy_until_ns = fake_lcd_now_ns + FAKE_LCD_EXEC_NS;
+    }
+}
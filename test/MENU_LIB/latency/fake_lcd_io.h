@@ -0,0 +1,36 @@
+/**
+ * @file fake_lcd_io.h
+ * @author niwciu (niwciu@gmail.com)
+ * @brief HD44780 timing model behind a fake LCD_IO_driver_interface_struct.
+ * @date 2025-12-04
+ *
+ * The fake GPIO layer drives a virtual clock: every pin operation costs
+ * FAKE_LCD_GPIO_OP_NS, delay_us() advances the clock and an emulated HD44780
+ * in 4-bit mode decodes the nibbles, keeps the busy flag set for the
+ * instruction execution time and stores characters in DDRAM. The bus
+ * counters let tests compare the cost of different write sequences.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#define FAKE_LCD_GPIO_OP_NS 500U        /* pin write or read incl. call overhead (8-bit MCU at 16 MHz) */
+#define FAKE_LCD_EXEC_NS 37000U         /* data write, set DDRAM address, entry mode, display on/off */
+#define FAKE_LCD_DATA_WRITE_NS 41000U   /* data write incl. address counter update (tADD) */
+#define FAKE_LCD_CLEAR_HOME_NS 1520000U /* clear display, return home */
+
+extern uint64_t fake_lcd_now_ns;
+extern uint64_t fake_lcd_last_glyph_commit_ns;
+extern uint32_t fake_lcd_data_writes;
+extern uint32_t fake_lcd_busy_violations;
+extern uint32_t fake_lcd_cmd_writes;
+extern uint32_t fake_lcd_write_e_strobes; /* E pulses latching a nibble written to the controller */
+extern uint32_t fake_lcd_read_e_strobes;  /* E pulses reading a nibble (busy flag polling) */
+extern uint32_t fake_lcd_pin_writes;      /* interface calls changing a pin or the data lines */
+extern char fake_lcd_ddram[128];
+
+uint32_t fake_lcd_get_time_us(void); /* virtual clock as a microsecond time source */
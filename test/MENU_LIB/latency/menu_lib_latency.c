@@ -0,0 +1,266 @@
+/**
+ * @file menu_lib_latency.c
+ * @author niwciu (niwciu@gmail.com)
+ * @brief Host harness measuring navigation input to display latency.
+ * @date 2025-12-04
+ *
+ * Runs the menu engine with the example display driver
+ * (menu_screen_driver_interface.c -> buffered lcd_hd44780.c) on top of an
+ * emulated HD44780 (fake_lcd_io.c) and replays a pseudo random navigation
+ * walk. Every input is timestamped on the virtual clock when it reaches the
+ * menu (button handler posting an event, or a direct menu_*() call); the
+ * latency ends when the last character changed by the input is committed by
+ * the controller during lcd_update(). Inputs that change no character
+ * (e.g. menu_next() on the last item, item callbacks) are only counted.
+ *
+ * The third input path posts events like the second one and flushes the
+ * display with lcd_update_step() calls of UPDATE_STEP_BUDGET bus transfers,
+ * one per main loop pass. The longest single lcd_update() or lcd_update_step()
+ * call of each path is reported as the main loop blocking time.
+ *
+ * The virtual clock includes only the display path (GPIO operations, delays,
+ * busy flag polling), not the CPU time of the menu engine itself, and starts
+ * after the keypad debounce time.
+ *
+ * The report (p50/p99/max and a histogram per operation and input path) is
+ * printed to stdout as JSON:
+ *
+ *     ./menu_lib_latency > latency.json
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include "menu_lib.h"
+#include "lcd_hd44780.h"
+#include "fake_lcd_io.h"
+#include "mock_menu_implementation.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define INPUTS_QTY 4000U
+#define IDLE_GAP_NS 50000000ULL /* 50 ms between two key presses */
+#define HISTOGRAM_BUCKET_US 500U
+#define HISTOGRAM_BUCKETS_QTY 12U
+#define RANDOM_SEED 0x2545F491U
+#define UPDATE_STEP_BUDGET 8U
+
+typedef enum
+{
+    INPUT_PATH_DIRECT,
+    INPUT_PATH_QUEUED,
+    INPUT_PATH_QUEUED_SLICED,
+    INPUT_PATHS_QTY,
+} input_path_e;
+
+typedef struct
+{
+    uint32_t samples_us[INPUTS_QTY];
+    uint32_t samples_qty;
+    uint32_t no_change_qty;
+} latency_stats_t;
+
+static const char *const input_path_names[INPUT_PATHS_QTY] = {"direct", "queued", "queued_sliced"};
+static const char *const op_names[] = {"next", "prev", "enter", "esc"};
+static void (*const direct_ops[])(void) = {menu_next, menu_prev, menu_enter, menu_esc};
+static const menu_event_t queued_ops[] = {MENU_EVENT_NEXT, MENU_EVENT_PREV, MENU_EVENT_ENTER, MENU_EVENT_ESC};
+
+#define OPS_QTY (sizeof(op_names) / sizeof(op_names[0]))
+
+static latency_stats_t latency_stats[INPUT_PATHS_QTY][OPS_QTY];
+static uint64_t max_update_call_ns[INPUT_PATHS_QTY];
+static uint32_t random_state = RANDOM_SEED;
+
+static void run_input_walk(input_path_e path);
+static uint8_t get_random_op(void);
+static void apply_input(input_path_e path, uint8_t op);
+static void update_display(input_path_e path);
+static void print_stats(latency_stats_t *stats, input_path_e path, uint8_t op, bool last);
+static int compare_u32(const void *a, const void *b);
+static uint32_t get_percentile(const latency_stats_t *stats, uint32_t percent);
+
+int main(void)
+{
+    lcd_set_time_source(fake_lcd_get_time_us);
+    menu_init();
+    lcd_update();
+
+    for (uint8_t path = 0U; path < INPUT_PATHS_QTY; path++)
+    {
+        run_input_walk((input_path_e)path);
+    }
+
+    printf("{\n");
+    printf("  \"harness\": \"menu_lib_latency\",\n");
+    printf("  \"display\": {\"driver\": \"lcd_hd44780 buffered\", \"rows\": %u, \"columns\": %u},\n", LCD_Y, LCD_X);
+    printf("  \"timing_model\": {\"gpio_op_ns\": %u, \"exec_ns\": %u, \"data_write_ns\": %u, \"clear_home_ns\": %u},\n",
+           FAKE_LCD_GPIO_OP_NS, FAKE_LCD_EXEC_NS, FAKE_LCD_DATA_WRITE_NS, FAKE_LCD_CLEAR_HOME_NS);
+    printf("  \"inputs_per_path\": %u,\n", INPUTS_QTY);
+    printf("  \"update_step_budget\": %u,\n", UPDATE_STEP_BUDGET);
+    printf("  \"max_update_call_us\": {");
+    for (uint8_t path = 0U; path < INPUT_PATHS_QTY; path++)
+    {
+        printf("\"%s\": %u%s", input_path_names[path], (unsigned)(max_update_call_ns[path] / 1000U), (path < (INPUT_PATHS_QTY - 1U)) ? ", " : "");
+    }
+    printf("},\n");
+    printf("  \"busy_violations\": %u,\n", (unsigned)fake_lcd_busy_violations);
+    printf("  \"operations\": [\n");
+    for (uint8_t path = 0U; path < INPUT_PATHS_QTY; path++)
+    {
+        for (uint8_t op = 0U; op < OPS_QTY; op++)
+        {
+            bool last = (path == (INPUT_PATHS_QTY - 1U)) && (op == (OPS_QTY - 1U));
+            print_stats(&latency_stats[path][op], (input_path_e)path, op, last);
+        }
+    }
+    printf("  ]\n");
+    printf("}\n");
+
+    return 0;
+}
+
+/**
+ * @brief Replay INPUTS_QTY random inputs from the top of the menu through one input path.
+ */
+static void run_input_walk(input_path_e path)
+{
+    random_state = RANDOM_SEED;
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    lcd_update();
+
+    for (uint32_t i = 0U; i < INPUTS_QTY; i++)
+    {
+        uint8_t op = get_random_op();
+        latency_stats_t *stats = &latency_stats[path][op];
+        uint64_t input_ns;
+        uint32_t data_writes;
+
+        fake_lcd_now_ns += IDLE_GAP_NS;
+        input_ns = fake_lcd_now_ns;
+        data_writes = fake_lcd_data_writes;
+
+        apply_input(path, op);
+        update_display(path);
+
+        if (fake_lcd_data_writes != data_writes)
+        {
+            stats->samples_us[stats->samples_qty] = (uint32_t)((fake_lcd_last_glyph_commit_ns - input_ns) / 1000U);
+            stats->samples_qty++;
+        }
+        else
+        {
+            stats->no_change_qty++;
+        }
+    }
+}
+
+/**
+ * @brief Draw the next operation: next 40 %, prev 30 %, enter 15 %, esc 15 %.
+ */
+static uint8_t get_random_op(void)
+{
+    uint32_t draw;
+
+    random_state = (random_state * 1664525U) + 1013904223U;
+    draw = (random_state >> 16) % 100U;
+
+    return (draw < 40U) ? 0U : ((draw < 70U) ? 1U : ((draw < 85U) ? 2U : 3U));
+}
+
+/**
+ * @brief One main loop pass of the example: the input reaches the menu, then the display is updated by the caller.
+ */
+static void apply_input(input_path_e path, uint8_t op)
+{
+    if (path == INPUT_PATH_DIRECT)
+    {
+        direct_ops[op]();
+    }
+    else
+    {
+        (void)menu_post_event(queued_ops[op]);
+        menu_process();
+    }
+}
+
+/**
+ * @brief Flush the display buffer the way the main loop of the input path does and track the longest call.
+ */
+static void update_display(input_path_e path)
+{
+    bool updated = false;
+
+    while (updated == false)
+    {
+        uint64_t call_ns = fake_lcd_now_ns;
+
+        if (path == INPUT_PATH_QUEUED_SLICED)
+        {
+            updated = lcd_update_step(UPDATE_STEP_BUDGET);
+        }
+        else
+        {
+            lcd_update();
+            updated = true;
+        }
+        call_ns = fake_lcd_now_ns - call_ns;
+        if (call_ns > max_update_call_ns[path])
+        {
+            max_update_call_ns[path] = call_ns;
+        }
+    }
+}
+
+static void print_stats(latency_stats_t *stats, input_path_e path, uint8_t op, bool last)
+{
+    uint32_t histogram[HISTOGRAM_BUCKETS_QTY] = {0};
+
+    qsort(stats->samples_us, stats->samples_qty, sizeof(stats->samples_us[0]), compare_u32);
+    for (uint32_t i = 0U; i < stats->samples_qty; i++)
+    {
+        uint32_t bucket = stats->samples_us[i] / HISTOGRAM_BUCKET_US;
+
+        histogram[(bucket < HISTOGRAM_BUCKETS_QTY) ? bucket : (HISTOGRAM_BUCKETS_QTY - 1U)]++;
+    }
+
+    printf("    {\"op\": \"%s\", \"path\": \"%s\", \"samples\": %u, \"no_change\": %u, "
+           "\"p50_us\": %u, \"p99_us\": %u, \"max_us\": %u, "
+           "\"histogram\": {\"bucket_us\": %u, \"counts\": [",
+           op_names[op],
+           input_path_names[path],
+           (unsigned)stats->samples_qty,
+           (unsigned)stats->no_change_qty,
+           (unsigned)get_percentile(stats, 50U),
+           (unsigned)get_percentile(stats, 99U),
+           (unsigned)get_percentile(stats, 100U),
+           HISTOGRAM_BUCKET_US);
+    for (uint8_t i = 0U; i < HISTOGRAM_BUCKETS_QTY; i++)
+    {
+        printf("%u%s", (unsigned)histogram[i], (i < (HISTOGRAM_BUCKETS_QTY - 1U)) ? ", " : "");
+    }
+    printf("]}}%s\n", last ? "" : ",");
+}
+
+static int compare_u32(const void *a, const void *b)
+{
+    uint32_t value_a = *(const uint32_t *)a;
+    uint32_t value_b = *(const uint32_t *)b;
+
+    return (value_a > value_b) - (value_a < value_b);
+}
+
+/**
+ * @brief Nearest-rank percentile of sorted samples, 0 when there are none.
+ */
+static uint32_t get_percentile(const latency_stats_t *stats, uint32_t percent)
+{
+    uint32_t percentile = 0U;
+
+    if (stats->samples_qty != 0U)
+    {
+        uint32_t rank = ((percent * stats->samples_qty) + 99U) / 100U;
+
+        percentile = stats->samples_us[(rank > 0U) ? (rank - 1U) : 0U];
+    }
+
+    return percentile;
+}
@@ -0,0 +1,148 @@
+#include "unity/fixture/unity_fixture.h"
+#include "lcd_hd44780.h"
+#include "fake_lcd_io.h"
+#include <stddef.h>
+
+#define POLL_PERIOD_NS 100000U /* other work done by the main loop between two lcd_init_poll() calls */
+#define LCD_INIT_STEPS_QTY 9U
+
+extern uint8_t lcd_init_next_step;
+extern bool lcd_ready;
+
+static uint64_t poll_lcd_init_until_ready(void);
+
+TEST_GROUP(lcd_hd44780_async_init);
+
+TEST_SETUP(lcd_hd44780_async_init)
+{
+    /* Init before every test */
+    lcd_set_time_source(fake_lcd_get_time_us);
+    fake_lcd_write_e_strobes = 0;
+    fake_lcd_data_writes = 0;
+}
+
+TEST_TEAR_DOWN(lcd_hd44780_async_init)
+{
+    /* Cleanup after every test */
+}
+
+TEST(lcd_hd44780_async_init, WhenLcdInitStartCalledThenItReturnsWithoutWaitingForLcdPowerUp)
+{
+    uint64_t start_ns = fake_lcd_now_ns;
+    // When
+    lcd_init_start();
+    // Then
+    TEST_ASSERT_TRUE((uint32_t)(fake_lcd_now_ns - start_ns) < 100000U);
+    TEST_ASSERT_FALSE(lcd_init_poll());
+    TEST_ASSERT_EQUAL(0, fake_lcd_write_e_strobes);
+}
+
+TEST(lcd_hd44780_async_init, GivenLcdInitStartedWhenPolledBeforePowerUpTimeElapsedThenNothingIsSentToLcd)
+{
+    // Given
+    lcd_init_start();
+    fake_lcd_now_ns += 14000000U;
+    // When
+    TEST_ASSERT_FALSE(lcd_init_poll());
+    // Then
+    TEST_ASSERT_EQUAL(0, fake_lcd_write_e_strobes);
+    fake_lcd_now_ns += 1000000U;
+    TEST_ASSERT_FALSE(lcd_init_poll());
+    TEST_ASSERT_TRUE(fake_lcd_write_e_strobes != 0);
+}
+
+TEST(lcd_hd44780_async_init, GivenLcdInitStartedWhenPolledPeriodicallyThenInitEndsWithoutBlockingAndBusyViolations)
+{
+    uint64_t start_ns = fake_lcd_now_ns;
+    uint64_t blocking_init_ns;
+    uint64_t longest_poll_ns;
+    // Given
+    lcd_init();
+    blocking_init_ns = fake_lcd_now_ns - start_ns;
+    start_ns = fake_lcd_now_ns;
+    lcd_init_start();
+    // When
+    longest_poll_ns = poll_lcd_init_until_ready();
+    // Then
+    // every init step is sent by the first poll after the wait of the previous one
+    TEST_ASSERT_TRUE((uint32_t)longest_poll_ns < 50000U);
+    TEST_ASSERT_TRUE((fake_lcd_now_ns - start_ns) < (blocking_init_ns + (LCD_INIT_STEPS_QTY * POLL_PERIOD_NS)));
+    TEST_ASSERT_EQUAL(0, fake_lcd_busy_violations);
+}
+
+TEST(lcd_hd44780_async_init, GivenLcdBufferWrittenBeforeInitEndsWhenLcdIsReadyThenLcdUpdateWritesTheBuffer)
+{
+    // Given
+    lcd_init_start();
+    lcd_buf_locate(LINE_2, C3);
+    lcd_buf_str("Booting");
+    lcd_update();
+    TEST_ASSERT_FALSE(lcd_update_step(UINT8_MAX));
+    TEST_ASSERT_EQUAL(0, fake_lcd_data_writes);
+    // When
+    (void)poll_lcd_init_until_ready();
+    lcd_update();
+    // Then
+    TEST_ASSERT_EQUAL(7, fake_lcd_data_writes);
+    TEST_ASSERT_EQUAL_STRING_LEN("  Booting ", &fake_lcd_ddram[LCD_LINE2_ADR], 10);
+    TEST_ASSERT_EQUAL(0, fake_lcd_busy_violations);
+}
+
+TEST(lcd_hd44780_async_init, GivenLcdNotInitializedWhenLcdInitPollCalledBeforeLcdInitStartThenReturnFalseAndNothingIsSent)
+{
+    // Given
+    lcd_init_next_step = 0U; /* power up state */
+    lcd_ready = false;
+    // When
+    bool ready = lcd_init_poll();
+    // Then
+    TEST_ASSERT_FALSE(ready);
+    TEST_ASSERT_EQUAL(0, fake_lcd_write_e_strobes);
+}
+
+TEST(lcd_hd44780_async_init, GivenLcdInitStartedWhenTimeSourceRemovedThenLcdInitPollReturnsFalse)
+{
+    // Given
+    lcd_init_start();
+    lcd_set_time_source(NULL);
+    fake_lcd_now_ns += 20000000U;
+    // When
+    bool ready = lcd_init_poll();
+    // Then
+    TEST_ASSERT_FALSE(ready);
+    TEST_ASSERT_EQUAL(0, fake_lcd_write_e_strobes);
+}
+
+TEST(lcd_hd44780_async_init, GivenNoTimeSourceWhenLcdInitStartCalledThenLcdIsInitializedByBlockingLcdInit)
+{
+    // Given
+    lcd_set_time_source(NULL);
+    // When
+    lcd_init_start();
+    // Then
+    TEST_ASSERT_TRUE(lcd_init_poll());
+    TEST_ASSERT_TRUE(lcd_update_step(UINT8_MAX));
+}
+
+/**
+ * @brief Call lcd_init_poll() every POLL_PERIOD_NS until the LCD is ready and return the longest call.
+ */
+static uint64_t poll_lcd_init_until_ready(void)
+{
+    uint64_t longest_poll_ns = 0U;
+    bool ready = false;
+
+    while (ready == false)
+    {
+        uint64_t call_ns = fake_lcd_now_ns;
+
+        ready = lcd_init_poll();
+        call_ns = fake_lcd_now_ns - call_ns;
+        if (call_ns > longest_poll_ns)
+        {
+            longest_poll_ns = call_ns;
+        }
+        fake_lcd_now_ns += POLL_PERIOD_NS;
+    }
+    return longest_poll_ns;
+}
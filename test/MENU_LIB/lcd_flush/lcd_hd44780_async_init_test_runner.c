@@ -0,0 +1,13 @@
+#include "unity/fixture/unity_fixture.h"
+
+TEST_GROUP_RUNNER(lcd_hd44780_async_init)
+{
+    /* Non blocking HD44780 init sequence Test cases to run */
+    RUN_TEST_CASE(lcd_hd44780_async_init, WhenLcdInitStartCalledThenItReturnsWithoutWaitingForLcdPowerUp);
+    RUN_TEST_CASE(lcd_hd44780_async_init, GivenLcdInitStartedWhenPolledBeforePowerUpTimeElapsedThenNothingIsSentToLcd);
+    RUN_TEST_CASE(lcd_hd44780_async_init, GivenLcdInitStartedWhenPolledPeriodicallyThenInitEndsWithoutBlockingAndBusyViolations);
+    RUN_TEST_CASE(lcd_hd44780_async_init, GivenLcdBufferWrittenBeforeInitEndsWhenLcdIsReadyThenLcdUpdateWritesTheBuffer);
+    RUN_TEST_CASE(lcd_hd44780_async_init, GivenLcdNotInitializedWhenLcdInitPollCalledBeforeLcdInitStartThenReturnFalseAndNothingIsSent);
+    RUN_TEST_CASE(lcd_hd44780_async_init, GivenLcdInitStartedWhenTimeSourceRemovedThenLcdInitPollReturnsFalse);
+    RUN_TEST_CASE(lcd_hd44780_async_init, GivenNoTimeSourceWhenLcdInitStartCalledThenLcdIsInitializedByBlockingLcdInit);
+}
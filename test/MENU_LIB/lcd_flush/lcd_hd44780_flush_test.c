@@ -0,0 +1,196 @@
+#include "unity/fixture/unity_fixture.h"
+#include "lcd_hd44780.h"
+#include "fake_lcd_io.h"
+#include <stddef.h>
+#include <string.h>
+
+static const uint8_t ddram_line_address[LCD_Y] = {LCD_LINE1_ADR, LCD_LINE2_ADR, LCD_LINE3_ADR, LCD_LINE4_ADR};
+
+static void reset_bus_counters(void);
+static void write_buf_line(enum LCD_LINES_e line, const char *str);
+static void assert_ddram_lines(const char *const *expected_lines);
+
+TEST_GROUP(lcd_hd44780_flush);
+
+TEST_SETUP(lcd_hd44780_flush)
+{
+    /* Init before every test */
+    lcd_init();
+    reset_bus_counters();
+}
+
+TEST_TEAR_DOWN(lcd_hd44780_flush)
+{
+    /* Cleanup after every test */
+}
+
+TEST(lcd_hd44780_flush, GivenSyncedScreenWhenOneCharChangedThenOneRelocationAndOneCharAreWritten)
+{
+    // Given
+    lcd_buf_locate(LINE_2, C5);
+    lcd_buf_char('X');
+    // When
+    lcd_update();
+    // Then
+    TEST_ASSERT_EQUAL(1, fake_lcd_cmd_writes);
+    TEST_ASSERT_EQUAL(1, fake_lcd_data_writes);
+    TEST_ASSERT_EQUAL(4, fake_lcd_write_e_strobes);
+    TEST_ASSERT_EQUAL('X', fake_lcd_ddram[LCD_LINE2_ADR + C5]);
+}
+
+TEST(lcd_hd44780_flush, GivenTwoChangesSeparatedByOneUnchangedCellWhenLcdUpdateThenGapIsRewrittenInsteadOfRelocating)
+{
+    const char *expected_lines[LCD_Y] = {
+        "                    ",
+        "A B                 ",
+        "                    ",
+        "                    "};
+    // Given
+    write_buf_line(LINE_2, "A B");
+    // When
+    lcd_update();
+    // Then
+    TEST_ASSERT_EQUAL(1, fake_lcd_cmd_writes);
+    TEST_ASSERT_EQUAL(3, fake_lcd_data_writes);
+    TEST_ASSERT_EQUAL(8, fake_lcd_write_e_strobes);
+    assert_ddram_lines(expected_lines);
+}
+
+TEST(lcd_hd44780_flush, GivenTwoChangesSeparatedByTwoUnchangedCellsWhenLcdUpdateThenCursorIsRelocated)
+{
+    const char *expected_lines[LCD_Y] = {
+        "                    ",
+        "A  B                ",
+        "                    ",
+        "                    "};
+    // Given
+    write_buf_line(LINE_2, "A  B");
+    // When
+    lcd_update();
+    // Then
+    TEST_ASSERT_EQUAL(2, fake_lcd_cmd_writes);
+    TEST_ASSERT_EQUAL(2, fake_lcd_data_writes);
+    TEST_ASSERT_EQUAL(8, fake_lcd_write_e_strobes);
+    assert_ddram_lines(expected_lines);
+}
+
+TEST(lcd_hd44780_flush, GivenCellWrittenByPreviousUpdateWhenNextCellChangesThenNoRelocationIsWritten)
+{
+    // Given
+    lcd_buf_locate(LINE_3, C1);
+    lcd_buf_char('A');
+    lcd_update();
+    reset_bus_counters();
+    lcd_buf_locate(LINE_3, C2);
+    lcd_buf_char('B');
+    // When
+    lcd_update();
+    // Then
+    TEST_ASSERT_EQUAL(0, fake_lcd_cmd_writes);
+    TEST_ASSERT_EQUAL(1, fake_lcd_data_writes);
+    TEST_ASSERT_EQUAL(2, fake_lcd_write_e_strobes);
+    TEST_ASSERT_EQUAL('B', fake_lcd_ddram[LCD_LINE3_ADR + C2]);
+}
+
+TEST(lcd_hd44780_flush, GivenLineChangeFlushedInStepsWhenLcdUpdateStepCalledThenOnlyFirstStepRelocates)
+{
+    const char *expected_lines[LCD_Y] = {
+        "                    ",
+        "ABCDEFGHIJKLMNOPQRST",
+        "                    ",
+        "                    "};
+    uint8_t steps_qty = 1;
+    // Given
+    write_buf_line(LINE_2, expected_lines[LINE_2]);
+    // When
+    while (lcd_update_step(4) == false)
+    {
+        steps_qty++;
+    }
+    // Then
+    TEST_ASSERT_EQUAL(6, steps_qty);
+    TEST_ASSERT_EQUAL(1, fake_lcd_cmd_writes);
+    TEST_ASSERT_EQUAL(LCD_X, fake_lcd_data_writes);
+    TEST_ASSERT_EQUAL(2 * (LCD_X + 1), fake_lcd_write_e_strobes);
+    assert_ddram_lines(expected_lines);
+}
+
+TEST(lcd_hd44780_flush, GivenCursorMovedByLcdLocateBetweenStepsWhenLcdUpdateStepCalledThenCursorIsRelocated)
+{
+    const char *expected_lines[LCD_Y] = {
+        "                    ",
+        "ABCDEFGHIJ          ",
+        "                    ",
+        "                    "};
+    // Given
+    write_buf_line(LINE_2, "ABCDEFGHIJ");
+    lcd_update_step(4);
+    lcd_locate(LINE_4, C10);
+    reset_bus_counters();
+    // When
+    lcd_update_step(UINT8_MAX);
+    // Then
+    TEST_ASSERT_EQUAL(1, fake_lcd_cmd_writes);
+    TEST_ASSERT_EQUAL(7, fake_lcd_data_writes);
+    assert_ddram_lines(expected_lines);
+}
+
+TEST(lcd_hd44780_flush, GivenMenuScreenWhenSelectionScrolledThenOnlyChangedSpansAreWritten)
+{
+    const char *menu_lines[LCD_Y] = {
+        "------- MENU -------",
+        " Settings           ",
+        " Network            ",
+        ">Display            "};
+    const char *expected_lines[LCD_Y] = {
+        "------- MENU -------",
+        " Network            ",
+        " Display            ",
+        ">Dimmer             "};
+    // Given
+    for (uint8_t line = 0; line < LCD_Y; line++)
+    {
+        write_buf_line(line, menu_lines[line]);
+    }
+    lcd_update();
+    reset_bus_counters();
+    for (uint8_t line = 0; line < LCD_Y; line++)
+    {
+        write_buf_line(line, expected_lines[line]);
+    }
+    // When
+    lcd_update();
+    // Then
+    // changed spans: line 2 columns 1 and 4-8 (a gap of 2 is relocated), line 3 columns 1-7, line 4 columns 3-7
+    TEST_ASSERT_EQUAL(4, fake_lcd_cmd_writes);
+    TEST_ASSERT_EQUAL(18, fake_lcd_data_writes);
+    TEST_ASSERT_EQUAL(2 * (4 + 18), fake_lcd_write_e_strobes);
+    assert_ddram_lines(expected_lines);
+}
+
+static void reset_bus_counters(void)
+{
+    fake_lcd_cmd_writes = 0;
+    fake_lcd_data_writes = 0;
+    fake_lcd_write_e_strobes = 0;
+    fake_lcd_read_e_strobes = 0;
+    fake_lcd_pin_writes = 0;
+}
+
+/**
+ * @brief Put the string at the beginning of the buffer line.
+ */
+static void write_buf_line(enum LCD_LINES_e line, const char *str)
+{
+    lcd_buf_locate(line, C1);
+    lcd_buf_str(str);
+}
+
+static void assert_ddram_lines(const char *const *expected_lines)
+{
+    TEST_ASSERT_EQUAL(0, fake_lcd_busy_violations);
+    for (uint8_t line = 0; line < LCD_Y; line++)
+    {
+        TEST_ASSERT_EQUAL_STRING_LEN(expected_lines[line], &fake_lcd_ddram[ddram_line_address[line]], LCD_X);
+    }
+}
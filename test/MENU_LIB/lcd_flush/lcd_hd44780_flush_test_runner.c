@@ -0,0 +1,13 @@
+#include "unity/fixture/unity_fixture.h"
+
+TEST_GROUP_RUNNER(lcd_hd44780_flush)
+{
+    /* Buffered HD44780 flush planner Test cases to run */
+    RUN_TEST_CASE(lcd_hd44780_flush, GivenSyncedScreenWhenOneCharChangedThenOneRelocationAndOneCharAreWritten);
+    RUN_TEST_CASE(lcd_hd44780_flush, GivenTwoChangesSeparatedByOneUnchangedCellWhenLcdUpdateThenGapIsRewrittenInsteadOfRelocating);
+    RUN_TEST_CASE(lcd_hd44780_flush, GivenTwoChangesSeparatedByTwoUnchangedCellsWhenLcdUpdateThenCursorIsRelocated);
+    RUN_TEST_CASE(lcd_hd44780_flush, GivenCellWrittenByPreviousUpdateWhenNextCellChangesThenNoRelocationIsWritten);
+    RUN_TEST_CASE(lcd_hd44780_flush, GivenLineChangeFlushedInStepsWhenLcdUpdateStepCalledThenOnlyFirstStepRelocates);
+    RUN_TEST_CASE(lcd_hd44780_flush, GivenCursorMovedByLcdLocateBetweenStepsWhenLcdUpdateStepCalledThenCursorIsRelocated);
+    RUN_TEST_CASE(lcd_hd44780_flush, GivenMenuScreenWhenSelectionScrolledThenOnlyChangedSpansAreWritten);
+}
@@ -0,0 +1,81 @@
+#include "unity/fixture/unity_fixture.h"
+#include "lcd_hd44780.h"
+#include "fake_lcd_io.h"
+#include <stddef.h>
+
+#define CPU_WORK_NS 100000U /* time spent by the application between two LCD writes */
+
+TEST_GROUP(lcd_hd44780_timing);
+
+TEST_SETUP(lcd_hd44780_timing)
+{
+    /* Init before every test */
+    lcd_set_time_source(fake_lcd_get_time_us);
+    lcd_init();
+    fake_lcd_read_e_strobes = 0;
+    fake_lcd_busy_violations = 0;
+}
+
+TEST_TEAR_DOWN(lcd_hd44780_timing)
+{
+    /* Cleanup after every test */
+}
+
+TEST(lcd_hd44780_timing, GivenByteWrittenWhenNextByteWrittenAfterExecutionTimeThenBusyFlagIsNotRead)
+{
+    // Given
+    lcd_locate(LINE_2, C1);
+    fake_lcd_now_ns += CPU_WORK_NS;
+    lcd_char('A');
+    fake_lcd_now_ns += CPU_WORK_NS;
+    // When
+    lcd_char('B');
+    fake_lcd_now_ns += CPU_WORK_NS;
+    // Then
+    TEST_ASSERT_EQUAL(0, fake_lcd_read_e_strobes);
+    TEST_ASSERT_EQUAL(0, fake_lcd_busy_violations);
+    TEST_ASSERT_EQUAL_STRING_LEN("AB", &fake_lcd_ddram[LCD_LINE2_ADR], 2);
+}
+
+TEST(lcd_hd44780_timing, GivenByteWrittenWhenNextByteWrittenBeforeExecutionTimeThenBusyFlagIsPolled)
+{
+    // Given
+    lcd_locate(LINE_2, C1);
+    // When
+    lcd_str("ABCDEFGH");
+    fake_lcd_now_ns += CPU_WORK_NS;
+    // Then
+    TEST_ASSERT_TRUE(fake_lcd_read_e_strobes != 0);
+    TEST_ASSERT_EQUAL(0, fake_lcd_busy_violations);
+    TEST_ASSERT_EQUAL_STRING_LEN("ABCDEFGH", &fake_lcd_ddram[LCD_LINE2_ADR], 8);
+}
+
+TEST(lcd_hd44780_timing, GivenLcdClearedWhenCharWrittenRightAfterThenItWaitsForClearExecution)
+{
+    // Given
+    lcd_locate(LINE_2, C1);
+    lcd_str("ABC");
+    lcd_cls();
+    // When
+    lcd_char('X');
+    fake_lcd_now_ns += CPU_WORK_NS;
+    // Then
+    TEST_ASSERT_EQUAL(0, fake_lcd_busy_violations);
+    TEST_ASSERT_EQUAL_STRING_LEN("X   ", &fake_lcd_ddram[LCD_LINE1_ADR], 4);
+    TEST_ASSERT_EQUAL_STRING_LEN("    ", &fake_lcd_ddram[LCD_LINE2_ADR], 4);
+}
+
+TEST(lcd_hd44780_timing, GivenNoTimeSourceWhenNextByteWrittenAfterExecutionTimeThenBusyFlagIsPolled)
+{
+    // Given
+    lcd_set_time_source(NULL);
+    lcd_locate(LINE_2, C1);
+    lcd_char('A');
+    fake_lcd_now_ns += CPU_WORK_NS;
+    fake_lcd_read_e_strobes = 0;
+    // When
+    lcd_char('B');
+    // Then
+    TEST_ASSERT_TRUE(fake_lcd_read_e_strobes != 0);
+    TEST_ASSERT_EQUAL(0, fake_lcd_busy_violations);
+}
@@ -0,0 +1,10 @@
+#include "unity/fixture/unity_fixture.h"
+
+TEST_GROUP_RUNNER(lcd_hd44780_timing)
+{
+    /* HD44780 adaptive execution time waits Test cases to run */
+    RUN_TEST_CASE(lcd_hd44780_timing, GivenByteWrittenWhenNextByteWrittenAfterExecutionTimeThenBusyFlagIsNotRead);
+    RUN_TEST_CASE(lcd_hd44780_timing, GivenByteWrittenWhenNextByteWrittenBeforeExecutionTimeThenBusyFlagIsPolled);
+    RUN_TEST_CASE(lcd_hd44780_timing, GivenLcdClearedWhenCharWrittenRightAfterThenItWaitsForClearExecution);
+    RUN_TEST_CASE(lcd_hd44780_timing, GivenNoTimeSourceWhenNextByteWrittenAfterExecutionTimeThenBusyFlagIsPolled);
+}
@@ -0,0 +1,48 @@
+/**
+ * @file menu.h
+ * @author niwciu (niwciu@gmail.com)
+ * @brief Menu configuration for the compile-time menu definition unit tests.
+ * @version 1.0.0
+ * @date 2025-12-08
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#ifndef MENU_USE_COMPACT_TABLE
+#define MENU_USE_COMPACT_TABLE
+#endif
+
+#include "menu_lib_type.h"
+
+#define MAX_MENU_DEPTH 3
+
+typedef enum
+{
+    CB_STATUS_UNKNOWN,
+    CB_EXECUTED,
+} mock_cb_status_e;
+
+/* Node indices of dsl_menu_table (depth first order of MENU_TABLE_DEFINE) */
+enum
+{
+    DSL_MENU_1,
+    DSL_SUB_MENU_1_1,
+    DSL_SUB_MENU_1_2,
+    DSL_MENU_2,
+    DSL_SUB_MENU_2_1,
+    DSL_SUB_MENU_2_1_1,
+    DSL_MENU_3,
+    DSL_MENU_4,
+    DSL_MENU_5,
+    DSL_MENU_NODES_QTY,
+};
+
+extern mock_cb_status_e mock_menu_callback_status;
+
+extern const menu_table_t dsl_menu_table;
+extern const uint16_t dsl_menu_level_items_qty[MAX_MENU_DEPTH];
+extern const uint16_t dsl_menu_max_name_length;
+
+void mock_set_callback_status_to_unknown(void);
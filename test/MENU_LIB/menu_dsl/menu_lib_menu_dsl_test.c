@@ -0,0 +1,132 @@
+#include "unity/fixture/unity_fixture.h"
+#include "menu_lib.h"
+#include "menu_screen_driver_interface.h"
+#include "mock_menu_screen_driver_interface.h"
+#include <stddef.h>
+
+extern menu_ctx_t menu_default_ctx;
+
+TEST_GROUP(menu_lib_menu_dsl);
+
+TEST_SETUP(menu_lib_menu_dsl)
+{
+    /* Init before every test */
+    init_mock_screen_driver();
+    menu_init();
+    mock_set_callback_status_to_unknown();
+}
+
+TEST_TEAR_DOWN(menu_lib_menu_dsl)
+{
+    /* Cleanup after every test */
+}
+
+TEST(menu_lib_menu_dsl, GivenMenuTableDefinedWithDslThenNodeCountDepthLevelItemsAndNameLengthAreComputed)
+{
+    TEST_ASSERT_EQUAL(DSL_MENU_NODES_QTY, dsl_menu_table.node_count);
+    TEST_ASSERT_EQUAL(3, dsl_menu_table.checked_depth);
+    TEST_ASSERT_EQUAL(5, dsl_menu_level_items_qty[0]);
+    TEST_ASSERT_EQUAL(3, dsl_menu_level_items_qty[1]);
+    TEST_ASSERT_EQUAL(1, dsl_menu_level_items_qty[2]);
+    TEST_ASSERT_EQUAL(10, dsl_menu_max_name_length);
+    TEST_ASSERT_EQUAL_STRING("menu_2_1_1", &dsl_menu_table.names[dsl_menu_table.nodes[DSL_SUB_MENU_2_1_1].name_offset]);
+}
+
+TEST(menu_lib_menu_dsl, WhenMenuViewInitWithDslMenuTableThenReturnOkWithoutRememberingTableAsValidatedAtRunTime)
+{
+    // When
+    menu_status_t status = menu_view_init(&dsl_menu_table, NULL, NULL);
+    // Then
+    TEST_ASSERT_EQUAL(MENU_OK, status);
+    TEST_ASSERT_NULL(menu_default_ctx.validated_menus[0]);
+}
+
+TEST(menu_lib_menu_dsl, WhenMenuViewInitWithDslMenuTableThenScreenContentIsEqualToExpected)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        ">menu_1             ",
+        " menu_2             ",
+        " menu_3             "};
+    // When
+    menu_view_init(&dsl_menu_table, NULL, NULL);
+    // Then
+    TEST_ASSERT_EQUAL(DSL_MENU_1, get_current_menu_position());
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_menu_dsl, GivenMenuViewInitWithDslMenuTableWhenMenuNextCalled10TimesThenLastItemSelectedAndScreenContentIsEqualToExpected)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        " menu_3             ",
+        " menu_4             ",
+        ">menu_5             "};
+    // Given
+    menu_view_init(&dsl_menu_table, NULL, NULL);
+    // When
+    for (uint8_t i = 0U; i < 10U; i++)
+    {
+        menu_next();
+    }
+    // Then
+    TEST_ASSERT_EQUAL(DSL_MENU_5, get_current_menu_position());
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_menu_dsl, GivenMenuNextCalledWhenMenuEnterCalledTwiceThenSubMenuHeaderShowsParentNameAndScreenContentIsEqualToExpected)
+{
+    const char *expected_screen[4] = {
+        "----- menu_2_1 -----",
+        ">menu_2_1_1         ",
+        "                    ",
+        "                    "};
+    // Given
+    menu_view_init(&dsl_menu_table, NULL, NULL);
+    menu_next();
+    // When
+    menu_enter();
+    menu_enter();
+    // Then
+    TEST_ASSERT_EQUAL(DSL_SUB_MENU_2_1_1, get_current_menu_position());
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_menu_dsl, GivenSubMenuItemSelectedWhenMenuEscCalledTwiceThenTopLevelItemIsSelected)
+{
+    // Given
+    menu_view_init(&dsl_menu_table, NULL, NULL);
+    menu_next();
+    menu_enter();
+    menu_enter();
+    // When
+    menu_esc();
+    menu_esc();
+    // Then
+    TEST_ASSERT_EQUAL(DSL_MENU_2, get_current_menu_position());
+}
+
+TEST(menu_lib_menu_dsl, GivenItemWithCallbackSelectedWhenMenuEnterThenCallbackIsExecuted)
+{
+    // Given
+    menu_view_init(&dsl_menu_table, NULL, NULL);
+    menu_enter();
+    menu_next();
+    // When
+    menu_enter();
+    // Then
+    TEST_ASSERT_EQUAL(DSL_SUB_MENU_1_2, get_current_menu_position());
+    TEST_ASSERT_EQUAL(CB_EXECUTED, mock_menu_callback_status);
+}
+
+TEST(menu_lib_menu_dsl, GivenItemWithoutCallbackSelectedWhenMenuEnterThenNoCallbackIsExecuted)
+{
+    // Given
+    menu_view_init(&dsl_menu_table, NULL, NULL);
+    menu_enter();
+    // When
+    menu_enter();
+    // Then
+    TEST_ASSERT_EQUAL(DSL_SUB_MENU_1_1, get_current_menu_position());
+    TEST_ASSERT_EQUAL(CB_STATUS_UNKNOWN, mock_menu_callback_status);
+}
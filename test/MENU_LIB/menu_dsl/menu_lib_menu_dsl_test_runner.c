@@ -0,0 +1,14 @@
+#include "unity/fixture/unity_fixture.h"
+
+TEST_GROUP_RUNNER(menu_lib_menu_dsl)
+{
+    /* Compile-time menu definition Test cases to run */
+    RUN_TEST_CASE(menu_lib_menu_dsl, GivenMenuTableDefinedWithDslThenNodeCountDepthLevelItemsAndNameLengthAreComputed);
+    RUN_TEST_CASE(menu_lib_menu_dsl, WhenMenuViewInitWithDslMenuTableThenReturnOkWithoutRememberingTableAsValidatedAtRunTime);
+    RUN_TEST_CASE(menu_lib_menu_dsl, WhenMenuViewInitWithDslMenuTableThenScreenContentIsEqualToExpected);
+    RUN_TEST_CASE(menu_lib_menu_dsl, GivenMenuViewInitWithDslMenuTableWhenMenuNextCalled10TimesThenLastItemSelectedAndScreenContentIsEqualToExpected);
+    RUN_TEST_CASE(menu_lib_menu_dsl, GivenMenuNextCalledWhenMenuEnterCalledTwiceThenSubMenuHeaderShowsParentNameAndScreenContentIsEqualToExpected);
+    RUN_TEST_CASE(menu_lib_menu_dsl, GivenSubMenuItemSelectedWhenMenuEscCalledTwiceThenTopLevelItemIsSelected);
+    RUN_TEST_CASE(menu_lib_menu_dsl, GivenItemWithCallbackSelectedWhenMenuEnterThenCallbackIsExecuted);
+    RUN_TEST_CASE(menu_lib_menu_dsl, GivenItemWithoutCallbackSelectedWhenMenuEnterThenNoCallbackIsExecuted);
+}
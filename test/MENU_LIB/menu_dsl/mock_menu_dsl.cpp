@@ -0,0 +1,56 @@
+/**
+ * @file mock_menu_dsl.cpp
+ * @author niwciu (niwciu@gmail.com)
+ * @brief Menu table defined with MENU_TABLE_DEFINE for the compile-time menu definition unit tests.
+ * @version 1.0.0
+ * @date 2025-12-08
+ *
+ * Same tree as compact_table/mock_menu_table.c, with links derived by menu_lib.hpp.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include "menu_lib.hpp"
+
+mock_cb_status_e mock_menu_callback_status = CB_STATUS_UNKNOWN;
+
+static void mock_menu_callback(void);
+
+MENU_TABLE_DEFINE(dsl_menu_table,
+                  menu_lib::submenu("menu_1",
+                                    menu_lib::item("menu_1_1"),
+                                    menu_lib::item("menu_1_2", mock_menu_callback)),
+                  menu_lib::submenu("menu_2",
+                                    menu_lib::submenu("menu_2_1",
+                                                      menu_lib::item("menu_2_1_1", mock_menu_callback))),
+                  menu_lib::item("menu_3"),
+                  menu_lib::item("menu_4"),
+                  menu_lib::item("menu_5", mock_menu_callback));
+
+/* Links derived at compile time */
+static_assert(dsl_menu_table_storage.nodes[DSL_MENU_1].prev == MENU_NO_NODE, "first item has no prev");
+static_assert(dsl_menu_table_storage.nodes[DSL_MENU_1].next == DSL_MENU_2, "next skips the submenu");
+static_assert(dsl_menu_table_storage.nodes[DSL_MENU_2].prev == DSL_MENU_1, "prev skips the submenu");
+static_assert(dsl_menu_table_storage.nodes[DSL_MENU_2].child == DSL_SUB_MENU_2_1, "child is the next item");
+static_assert(dsl_menu_table_storage.nodes[DSL_SUB_MENU_1_2].next == MENU_NO_NODE, "last submenu item has no next");
+static_assert(dsl_menu_table_storage.nodes[DSL_SUB_MENU_2_1_1].parent == DSL_SUB_MENU_2_1, "parent is one level up");
+static_assert(dsl_menu_table_storage.nodes[DSL_MENU_5].next == MENU_NO_NODE, "last item has no next");
+static_assert(dsl_menu_table_storage.depth == 3U, "three levels");
+static_assert(sizeof(dsl_menu_table_storage.callbacks) == (3U * sizeof(menu_callback_t)), "one callback entry per item with callback");
+
+const uint16_t dsl_menu_level_items_qty[MAX_MENU_DEPTH] = {
+    dsl_menu_table_storage.level_items_qty[0],
+    dsl_menu_table_storage.level_items_qty[1],
+    dsl_menu_table_storage.level_items_qty[2],
+};
+const uint16_t dsl_menu_max_name_length = dsl_menu_table_storage.max_name_length;
+
+void mock_set_callback_status_to_unknown(void)
+{
+    mock_menu_callback_status = CB_STATUS_UNKNOWN;
+}
+
+static void mock_menu_callback(void)
+{
+    mock_menu_callback_status = CB_EXECUTED;
+}
@@ -0,0 +1,426 @@
+/**
+ * @file menu_lib_bench.c
+ * @author niwciu (niwciu@gmail.com)
+ * @brief Host benchmark for the menu engine.
+ * @date 2025-11-20
+ *
+ * Builds synthetic menu trees (wide: 1 x 250 items, deep: MAX_MENU_DEPTH x 10
+ * items, mixed), replays scripted navigation sequences on them with every
+ * driver type and render mode, and reports per operation driver calls,
+ * characters emitted, cursor moves, wall-clock time and the bus time
+ * estimated by the profiling driver for every cost model.
+ *
+ * The report is printed to stdout as a single JSON document, so results of
+ * two releases can be compared with any JSON aware tool:
+ *
+ *     ./menu_lib_bench > bench_1.0.0.json
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include "menu_lib.h"
+#include "bench_screen_driver.h"
+#include "profiling_screen_driver.h"
+#include <stdio.h>
+#include <time.h>
+
+#define BENCH_NAME_SIZE 12U
+#define SCRIPT_REPETITIONS 200U
+
+#define WIDE_MENU_ITEMS 250U
+#define DEEP_MENU_ITEMS_PER_LEVEL 10U
+#define MIXED_MENU_TOP_ITEMS 8U
+#define MIXED_MENU_SUB_ITEMS 6U
+#define MIXED_MENU_LEAF_ITEMS 4U
+
+#define POSITION_STEP 50U
+#define REDRAW_ITERATIONS 20000U
+
+#define BENCH_ITEMS_QTY (WIDE_MENU_ITEMS +                                  \
+                         (MAX_MENU_DEPTH * DEEP_MENU_ITEMS_PER_LEVEL) +     \
+                         MIXED_MENU_TOP_ITEMS +                             \
+                         (MIXED_MENU_TOP_ITEMS * MIXED_MENU_SUB_ITEMS) +    \
+                         (MIXED_MENU_TOP_ITEMS * MIXED_MENU_SUB_ITEMS * MIXED_MENU_LEAF_ITEMS))
+
+typedef enum
+{
+    BENCH_OP_NEXT,
+    BENCH_OP_PREV,
+    BENCH_OP_ENTER,
+    BENCH_OP_ESC,
+    BENCH_OP_PAGE_DOWN,
+    BENCH_OP_FIRST,
+    BENCH_OP_LAST,
+    BENCH_OP_REDRAW,
+    BENCH_OP_END,
+} bench_op_e;
+
+typedef struct
+{
+    bench_op_e op;
+    uint16_t repeat;
+} bench_step_t;
+
+typedef struct
+{
+    const char *tree_name;
+    const char *script_name;
+    menu_t *root;
+    const bench_step_t *setup;  /* not measured, replayed after every view init */
+    const bench_step_t *script; /* measured */
+} bench_scenario_t;
+
+typedef struct
+{
+    const char *name;
+    const struct menu_screen_driver_interface_struct *(*get_interface)(void);
+} bench_driver_t;
+
+static menu_t bench_items[BENCH_ITEMS_QTY];
+static char bench_names[BENCH_ITEMS_QTY][BENCH_NAME_SIZE];
+static uint16_t bench_items_used;
+
+static menu_t *wide_menu;
+static menu_t *deep_menu;
+static menu_t *mixed_menu;
+
+static menu_ctx_t bench_ctx;
+
+/* --- Navigation scripts --- */
+static const bench_step_t no_setup[] = {{BENCH_OP_END, 0U}};
+static const bench_step_t setup_last[] = {{BENCH_OP_LAST, 1U}, {BENCH_OP_END, 0U}};
+static const bench_step_t setup_bottom_level[] = {{BENCH_OP_ENTER, MAX_MENU_DEPTH - 1U}, {BENCH_OP_END, 0U}};
+
+static const bench_step_t script_scroll_down[] = {{BENCH_OP_NEXT, WIDE_MENU_ITEMS - 1U}, {BENCH_OP_END, 0U}};
+static const bench_step_t script_scroll_up[] = {{BENCH_OP_PREV, WIDE_MENU_ITEMS - 1U}, {BENCH_OP_END, 0U}};
+static const bench_step_t script_page_down[] = {{BENCH_OP_PAGE_DOWN, WIDE_MENU_ITEMS / (BENCH_LCD_Y - 1U)}, {BENCH_OP_END, 0U}};
+static const bench_step_t script_redraw[] = {{BENCH_OP_REDRAW, 100U}, {BENCH_OP_END, 0U}};
+static const bench_step_t script_dive_and_return[] = {
+    {BENCH_OP_ENTER, MAX_MENU_DEPTH - 1U},
+    {BENCH_OP_ESC, MAX_MENU_DEPTH - 1U},
+    {BENCH_OP_END, 0U}};
+static const bench_step_t script_browse_level[] = {
+    {BENCH_OP_NEXT, DEEP_MENU_ITEMS_PER_LEVEL - 1U},
+    {BENCH_OP_PREV, DEEP_MENU_ITEMS_PER_LEVEL - 1U},
+    {BENCH_OP_END, 0U}};
+static const bench_step_t script_tour[] = {
+    {BENCH_OP_ENTER, 1U},
+    {BENCH_OP_NEXT, 1U},
+    {BENCH_OP_ENTER, 1U},
+    {BENCH_OP_NEXT, 3U},
+    {BENCH_OP_ESC, 1U},
+    {BENCH_OP_NEXT, 2U},
+    {BENCH_OP_ESC, 1U},
+    {BENCH_OP_NEXT, 3U},
+    {BENCH_OP_ENTER, 1U},
+    {BENCH_OP_NEXT, 5U},
+    {BENCH_OP_ESC, 1U},
+    {BENCH_OP_LAST, 1U},
+    {BENCH_OP_FIRST, 1U},
+    {BENCH_OP_END, 0U}};
+
+static bench_scenario_t bench_scenarios[] = {
+    {"wide", "scroll_down", NULL, no_setup, script_scroll_down},
+    {"wide", "scroll_up", NULL, setup_last, script_scroll_up},
+    {"wide", "page_down", NULL, no_setup, script_page_down},
+    {"wide", "redraw_at_end", NULL, setup_last, script_redraw},
+    {"deep", "dive_and_return", NULL, no_setup, script_dive_and_return},
+    {"deep", "browse_bottom_level", NULL, setup_bottom_level, script_browse_level},
+    {"mixed", "tour", NULL, no_setup, script_tour},
+    {"mixed", "redraw", NULL, no_setup, script_redraw},
+};
+
+static const bench_driver_t bench_drivers[] = {
+    {"per-char", get_menu_display_driver_interface},
+    {"row-write", bench_get_row_write_driver_interface},
+};
+
+static const menu_render_mode_t bench_render_modes[] = {MENU_RENDER_FULL, MENU_RENDER_INCREMENTAL};
+
+static const profiling_cost_model_t *const bench_cost_models[] = {
+    &profiling_hd44780_busy_flag_model,
+    &profiling_hd44780_fixed_delay_model,
+    &profiling_pcf8574_i2c_model,
+    &profiling_vt100_uart_model,
+};
+
+static menu_t *build_level(uint16_t items_qty, menu_t *parent, const char *prefix);
+static void build_bench_trees(void);
+static uint64_t now_ns(void);
+static uint32_t run_steps(const bench_step_t *steps);
+static void run_op(bench_op_e op);
+static void bench_scenario(const bench_scenario_t *scenario, const bench_driver_t *driver, menu_render_mode_t mode, bool last);
+static void print_scenario_bus_time(const bench_scenario_t *scenario, const bench_driver_t *driver, menu_render_mode_t mode);
+static void bench_redraw_cost_vs_list_position(void);
+
+int main(void)
+{
+    build_bench_trees();
+
+    printf("{\n");
+    printf("  \"benchmark\": \"menu_lib\",\n");
+    printf("  \"screen\": {\"rows\": %u, \"columns\": %u},\n", BENCH_LCD_Y, BENCH_LCD_X);
+    printf("  \"max_menu_depth\": %u,\n", MAX_MENU_DEPTH);
+    printf("  \"repetitions\": %u,\n", SCRIPT_REPETITIONS);
+    printf("  \"scenarios\": [\n");
+
+    const size_t scenarios_qty = sizeof(bench_scenarios) / sizeof(bench_scenarios[0]);
+    const size_t drivers_qty = sizeof(bench_drivers) / sizeof(bench_drivers[0]);
+    const size_t modes_qty = sizeof(bench_render_modes) / sizeof(bench_render_modes[0]);
+
+    for (size_t s = 0U; s < scenarios_qty; s++)
+    {
+        for (size_t d = 0U; d < drivers_qty; d++)
+        {
+            for (size_t m = 0U; m < modes_qty; m++)
+            {
+                bool last = (s == (scenarios_qty - 1U)) && (d == (drivers_qty - 1U)) && (m == (modes_qty - 1U));
+                bench_scenario(&bench_scenarios[s], &bench_drivers[d], bench_render_modes[m], last);
+            }
+        }
+    }
+
+    printf("  ],\n");
+    bench_redraw_cost_vs_list_position();
+    printf("}\n");
+
+    return 0;
+}
+
+/**
+ * @brief Link items_qty new items as one menu level below parent.
+ */
+static menu_t *build_level(uint16_t items_qty, menu_t *parent, const char *prefix)
+{
+    menu_t *level = &bench_items[bench_items_used];
+
+    for (uint16_t i = 0U; i < items_qty; i++)
+    {
+        menu_t *item = &level[i];
+
+        snprintf(bench_names[bench_items_used], BENCH_NAME_SIZE, "%s_%u", prefix, (unsigned)i);
+        item->name = bench_names[bench_items_used];
+        item->next = (i < (items_qty - 1U)) ? &level[i + 1U] : NULL;
+        item->prev = (i > 0U) ? &level[i - 1U] : NULL;
+        item->child = NULL;
+        item->parent = parent;
+        item->callback = NULL;
+        bench_items_used++;
+    }
+    if (parent != NULL)
+    {
+        parent->child = level;
+    }
+
+    return level;
+}
+
+static void build_bench_trees(void)
+{
+    menu_t *parent = NULL;
+
+    /* wide: one level of WIDE_MENU_ITEMS items */
+    wide_menu = build_level(WIDE_MENU_ITEMS, NULL, "item");
+
+    /* deep: MAX_MENU_DEPTH levels, the first item of each level opens the next one */
+    for (uint8_t depth = 0U; depth < MAX_MENU_DEPTH; depth++)
+    {
+        menu_t *level = build_level(DEEP_MENU_ITEMS_PER_LEVEL, parent, "deep");
+
+        if (depth == 0U)
+        {
+            deep_menu = level;
+        }
+        parent = level;
+    }
+
+    /* mixed: every top item has a submenu, every second submenu item has leaves */
+    mixed_menu = build_level(MIXED_MENU_TOP_ITEMS, NULL, "top");
+    for (uint8_t t = 0U; t < MIXED_MENU_TOP_ITEMS; t++)
+    {
+        menu_t *sub = build_level(MIXED_MENU_SUB_ITEMS, &mixed_menu[t], "sub");
+
+        for (uint8_t s = 1U; s < MIXED_MENU_SUB_ITEMS; s += 2U)
+        {
+            (void)build_level(MIXED_MENU_LEAF_ITEMS, &sub[s], "leaf");
+        }
+    }
+
+    for (size_t i = 0U; i < (sizeof(bench_scenarios) / sizeof(bench_scenarios[0])); i++)
+    {
+        const char *tree = bench_scenarios[i].tree_name;
+
+        bench_scenarios[i].root = (tree[0] == 'w') ? wide_menu : ((tree[0] == 'd') ? deep_menu : mixed_menu);
+    }
+}
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Replay a script on bench_ctx.
+ *
+ * @return uint32_t Number of executed operations.
+ */
+static uint32_t run_steps(const bench_step_t *steps)
+{
+    uint32_t ops = 0U;
+
+    for (; steps->op != BENCH_OP_END; steps++)
+    {
+        for (uint16_t i = 0U; i < steps->repeat; i++)
+        {
+            run_op(steps->op);
+            ops++;
+        }
+    }
+
+    return ops;
+}
+
+static void run_op(bench_op_e op)
+{
+    switch (op)
+    {
+    case BENCH_OP_NEXT:
+        menu_ctx_next(&bench_ctx);
+        break;
+    case BENCH_OP_PREV:
+        menu_ctx_prev(&bench_ctx);
+        break;
+    case BENCH_OP_ENTER:
+        menu_ctx_enter(&bench_ctx);
+        break;
+    case BENCH_OP_ESC:
+        menu_ctx_esc(&bench_ctx);
+        break;
+    case BENCH_OP_PAGE_DOWN:
+        menu_ctx_page_down(&bench_ctx);
+        break;
+    case BENCH_OP_FIRST:
+        menu_ctx_first(&bench_ctx);
+        break;
+    case BENCH_OP_LAST:
+        menu_ctx_last(&bench_ctx);
+        break;
+    case BENCH_OP_REDRAW:
+        menu_ctx_update_screen_view(&bench_ctx);
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief Replay one scenario SCRIPT_REPETITIONS times and print its JSON record.
+ */
+static void bench_scenario(const bench_scenario_t *scenario, const bench_driver_t *driver, menu_render_mode_t mode, bool last)
+{
+    bench_driver_counters_t total = {0};
+    uint64_t elapsed = 0U;
+    uint32_t ops = 0U;
+
+    menu_ctx_init(&bench_ctx, driver->get_interface());
+    menu_ctx_set_render_mode(&bench_ctx, mode);
+
+    for (uint32_t r = 0U; r < SCRIPT_REPETITIONS; r++)
+    {
+        menu_ctx_view_init(&bench_ctx, scenario->root, NULL, NULL);
+        (void)run_steps(scenario->setup);
+
+        bench_reset_driver_counters();
+        uint64_t start = now_ns();
+        ops = run_steps(scenario->script);
+        elapsed += now_ns() - start;
+
+        total.cursor_position_calls += bench_driver_counters.cursor_position_calls;
+        total.print_string_calls += bench_driver_counters.print_string_calls;
+        total.print_char_calls += bench_driver_counters.print_char_calls;
+        total.write_row_calls += bench_driver_counters.write_row_calls;
+        total.fill_calls += bench_driver_counters.fill_calls;
+        total.chars_emitted += bench_driver_counters.chars_emitted;
+    }
+
+    double total_ops = (double)ops * SCRIPT_REPETITIONS;
+    uint32_t total_calls = total.cursor_position_calls + total.print_string_calls + total.print_char_calls +
+                           total.write_row_calls + total.fill_calls;
+
+    printf("    {\"tree\": \"%s\", \"script\": \"%s\", \"driver\": \"%s\", \"render_mode\": \"%s\", "
+           "\"ops\": %u, \"driver_calls_per_op\": %.2f, \"chars_per_op\": %.2f, "
+           "\"cursor_moves_per_op\": %.2f, \"ns_per_op\": %.1f, ",
+           scenario->tree_name,
+           scenario->script_name,
+           driver->name,
+           (mode == MENU_RENDER_FULL) ? "full" : "incremental",
+           (unsigned)ops,
+           (double)total_calls / total_ops,
+           (double)total.chars_emitted / total_ops,
+           (double)total.cursor_position_calls / total_ops,
+           (double)elapsed / total_ops);
+    print_scenario_bus_time(scenario, driver, mode);
+    printf("}%s\n", last ? "" : ",");
+}
+
+/**
+ * @brief Replay the scenario once through the profiling driver for every cost model.
+ */
+static void print_scenario_bus_time(const bench_scenario_t *scenario, const bench_driver_t *driver, menu_render_mode_t mode)
+{
+    const size_t models_qty = sizeof(bench_cost_models) / sizeof(bench_cost_models[0]);
+
+    printf("\"bus_us_per_op\": {");
+    for (size_t m = 0U; m < models_qty; m++)
+    {
+        menu_ctx_init(&bench_ctx, profiling_driver_init(driver->get_interface(), bench_cost_models[m]));
+        menu_ctx_set_render_mode(&bench_ctx, mode);
+        menu_ctx_view_init(&bench_ctx, scenario->root, NULL, NULL);
+        (void)run_steps(scenario->setup);
+
+        profiling_reset_trace();
+        uint32_t ops = run_steps(scenario->script);
+
+        printf("\"%s\": %.1f%s",
+               bench_cost_models[m]->name,
+               (double)profiling_get_bus_time_ns() / (1000.0 * ops),
+               (m < (models_qty - 1U)) ? ", " : "");
+    }
+    printf("}");
+}
+
+/**
+ * @brief Full redraw cost at several cursor positions of the wide menu.
+ *
+ * The cost should not depend on the position (window top is cached per level).
+ */
+static void bench_redraw_cost_vs_list_position(void)
+{
+    menu_ctx_init(&bench_ctx, get_menu_display_driver_interface());
+    menu_ctx_view_init(&bench_ctx, wide_menu, NULL, NULL);
+
+    printf("  \"redraw_vs_position\": [\n");
+    for (uint16_t position = 0U; position < WIDE_MENU_ITEMS; position += POSITION_STEP)
+    {
+        bench_reset_driver_counters();
+        uint64_t start = now_ns();
+        for (uint32_t i = 0U; i < REDRAW_ITERATIONS; i++)
+        {
+            menu_ctx_update_screen_view(&bench_ctx);
+        }
+        uint64_t elapsed = now_ns() - start;
+
+        printf("    {\"position\": %u, \"ns_per_redraw\": %.1f, \"driver_calls_per_redraw\": %u}%s\n",
+               (unsigned)position,
+               (double)elapsed / REDRAW_ITERATIONS,
+               (unsigned)(bench_driver_calls() / REDRAW_ITERATIONS),
+               ((position + POSITION_STEP) < WIDE_MENU_ITEMS) ? "," : "");
+
+        menu_ctx_move_by(&bench_ctx, (int16_t)POSITION_STEP);
+    }
+    printf("  ]\n");
+}
@@ -0,0 +1,91 @@
+/**
+ * @file menu_lib_bench_binding.c
+ * @author niwciu (niwciu@gmail.com)
+ * @brief Host benchmark comparing driver binding modes.
+ * @date 2025-12-10
+ *
+ * Built twice: against the engine calling the per character bench driver
+ * through the driver interface pointers and against the engine built with
+ * MENU_USE_STATIC_DRIVER (bench_static_driver.h). Both replay the same
+ * navigation cycle on mock_menu_1 with full redraws and print one JSON line:
+ *
+ *     ./menu_lib_bench_binding_pointer
+ *     ./menu_lib_bench_binding_static
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include "menu_lib.h"
+#include "bench_screen_driver.h"
+#include "mock_menu_implementation.h"
+#include <stdio.h>
+#include <time.h>
+
+#ifdef MENU_USE_STATIC_DRIVER
+#define BENCH_BINDING_NAME "static"
+#else
+#define BENCH_BINDING_NAME "pointer"
+#endif
+
+#define CYCLES_QTY 20000U
+#define CYCLE_OPS_QTY 12U
+
+static menu_ctx_t bench_ctx;
+
+static uint64_t now_ns(void);
+static void run_navigation_cycle(void);
+
+int main(void)
+{
+    uint64_t start;
+    uint64_t elapsed;
+    uint32_t ops = CYCLES_QTY * CYCLE_OPS_QTY;
+
+    menu_ctx_init(&bench_ctx, get_menu_display_driver_interface());
+    menu_ctx_view_init(&bench_ctx, &mock_menu_1, NULL, NULL);
+    bench_reset_driver_counters();
+
+    start = now_ns();
+    for (uint32_t i = 0U; i < CYCLES_QTY; i++)
+    {
+        run_navigation_cycle();
+    }
+    elapsed = now_ns() - start;
+
+    printf("{\"binding\": \"%s\", \"ops\": %u, \"ns_per_op\": %.1f, \"driver_calls_per_op\": %.2f, \"chars_per_op\": %.2f}\n",
+           BENCH_BINDING_NAME,
+           (unsigned)ops,
+           (double)elapsed / (double)ops,
+           (double)bench_driver_calls() / (double)ops,
+           (double)bench_driver_counters.chars_emitted / (double)ops);
+
+    return 0;
+}
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief CYCLE_OPS_QTY operations ending at the first top level item again.
+ */
+static void run_navigation_cycle(void)
+{
+    for (uint8_t i = 0U; i < 4U; i++)
+    {
+        menu_ctx_next(&bench_ctx);
+    }
+    for (uint8_t i = 0U; i < 4U; i++)
+    {
+        menu_ctx_prev(&bench_ctx);
+    }
+    menu_ctx_enter(&bench_ctx);
+    menu_ctx_next(&bench_ctx);
+    menu_ctx_next(&bench_ctx);
+    menu_ctx_esc(&bench_ctx);
+}
@@ -0,0 +1,343 @@
+#include "unity/fixture/unity_fixture.h"
+#include "menu_lib.h"
+#include "mock_menu_implementation.h"
+#include "menu_screen_driver_interface.h"
+#include "mock_menu_screen_driver_interface.h"
+#include <stddef.h>
+#include <string.h>
+
+#define TERMINAL_X 16
+#define TERMINAL_Y 2
+
+static char terminal_screen[TERMINAL_Y][TERMINAL_X + 1];
+static uint8_t terminal_cur_x;
+static uint8_t terminal_cur_y;
+
+static void terminal_screen_init(void);
+static uint8_t terminal_get_number_of_screen_lines(void);
+static uint8_t terminal_get_number_of_chars_per_line(void);
+static void terminal_cursor_position(uint8_t row, uint8_t column);
+static void terminal_print_string(const char *str);
+static void terminal_print_char(const char C);
+
+static const struct menu_screen_driver_interface_struct terminal_driver_interface = {
+    terminal_screen_init,
+    terminal_get_number_of_screen_lines,
+    terminal_get_number_of_chars_per_line,
+    terminal_screen_init,
+    terminal_cursor_position,
+    terminal_print_string,
+    terminal_print_char,
+    NULL,
+    NULL,
+    NULL,
+};
+
+static menu_ctx_t panel_ctx;
+static menu_ctx_t terminal_ctx;
+
+TEST_GROUP(menu_lib_ctx);
+
+TEST_SETUP(menu_lib_ctx)
+{
+    /* Init before every test */
+    init_mock_screen_driver();
+}
+
+TEST_TEAR_DOWN(menu_lib_ctx)
+{
+    /* Cleanup after every test */
+}
+
+TEST(menu_lib_ctx, WhenMenuCtxInitWithNullContextThenReturnNoContext)
+{
+    // When
+    menu_status_t status = menu_ctx_init(NULL, &terminal_driver_interface);
+    // Then
+    TEST_ASSERT_EQUAL(MENU_ERR_NO_CONTEXT, status);
+}
+
+TEST(menu_lib_ctx, WhenMenuCtxInitWithNullDisplayThenReturnNoDisplayInterfaceAndViewInitReturnNotInitialized)
+{
+    // When
+    menu_status_t status = menu_ctx_init(&terminal_ctx, NULL);
+    // Then
+    TEST_ASSERT_EQUAL(MENU_ERR_NO_DISPLAY_INTERFACE, status);
+    TEST_ASSERT_EQUAL(MENU_ERR_NOT_INITIALIZED, menu_ctx_view_init(&terminal_ctx, &mock_menu_1, NULL, NULL));
+}
+
+TEST(menu_lib_ctx, GivenTerminalCtxInitWith1602ScreenWhenMenuCtxViewInitCalledThenTerminalScreenContentIsEqualToExpected)
+{
+    const char *expected_screen[TERMINAL_Y] = {
+        "------- MENU ---",
+        ">menu_1         "};
+    const char *terminal_lines[TERMINAL_Y] = {terminal_screen[0], terminal_screen[1]};
+    // Given
+    menu_ctx_init(&terminal_ctx, &terminal_driver_interface);
+    // When
+    menu_status_t status = menu_ctx_view_init(&terminal_ctx, &mock_menu_1, NULL, NULL);
+    // Then
+    TEST_ASSERT_EQUAL(MENU_OK, status);
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, terminal_lines, TERMINAL_Y);
+}
+
+TEST(menu_lib_ctx, GivenPanelCtxAndTerminalCtxInitWithSameMenuWhenNavigatedIndependentlyThenEachCtxKeepsItsOwnPositionAndScreen)
+{
+    const char *expected_panel_screen[4] = {
+        "------- MENU -------",
+        " menu_1             ",
+        " menu_2             ",
+        ">menu_3             "};
+    const char *expected_terminal_screen[TERMINAL_Y] = {
+        "---- menu_2 ----",
+        ">menu_2_1       "};
+    const char *terminal_lines[TERMINAL_Y] = {terminal_screen[0], terminal_screen[1]};
+    // Given
+    menu_ctx_init(&panel_ctx, get_menu_display_driver_interface());
+    menu_ctx_init(&terminal_ctx, &terminal_driver_interface);
+    menu_ctx_view_init(&panel_ctx, &mock_menu_1, NULL, NULL);
+    menu_ctx_view_init(&terminal_ctx, &mock_menu_1, NULL, NULL);
+    // When
+    menu_ctx_next(&panel_ctx);
+    menu_ctx_next(&terminal_ctx);
+    menu_ctx_next(&panel_ctx);
+    menu_ctx_enter(&terminal_ctx);
+    // Then
+    TEST_ASSERT_EQUAL(&mock_menu_3, menu_ctx_get_current_menu_position(&panel_ctx));
+    TEST_ASSERT_EQUAL(&mock_sub_menu_2_1, menu_ctx_get_current_menu_position(&terminal_ctx));
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_panel_screen, mock_screen_lines, LCD_Y);
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_terminal_screen, terminal_lines, TERMINAL_Y);
+}
+
+TEST(menu_lib_ctx, GivenDefaultMenuViewInitWhenOtherCtxNavigatedThenGetCurrentMenuPositionIsNotChanged)
+{
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    menu_ctx_init(&terminal_ctx, &terminal_driver_interface);
+    menu_ctx_view_init(&terminal_ctx, &mock_menu_1, NULL, NULL);
+    // When
+    menu_ctx_next(&terminal_ctx);
+    menu_ctx_next(&terminal_ctx);
+    // Then
+    TEST_ASSERT_EQUAL(&mock_menu_1, get_current_menu_position());
+    TEST_ASSERT_EQUAL(&mock_menu_3, menu_ctx_get_current_menu_position(&terminal_ctx));
+}
+
+TEST(menu_lib_ctx, GivenDefaultMenuViewInitWhenMenuCtxNextWithNullContextThenNothingIsChanged)
+{
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    mock_reset_driver_call_counters();
+    // When
+    menu_ctx_next(NULL);
+    // Then
+    TEST_ASSERT_EQUAL(&mock_menu_1, get_current_menu_position());
+    TEST_ASSERT_EQUAL(0, mock_cursor_position_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_print_string_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_print_char_call_counter);
+}
+
+TEST(menu_lib_ctx, GivenDefaultMenuViewInitWhenMenuCtxPrevWithNullContextThenNothingIsChanged)
+{
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    mock_reset_driver_call_counters();
+    // When
+    menu_ctx_prev(NULL);
+    // Then
+    TEST_ASSERT_EQUAL(&mock_menu_1, get_current_menu_position());
+    TEST_ASSERT_EQUAL(0, mock_cursor_position_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_print_string_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_print_char_call_counter);
+}
+
+TEST(menu_lib_ctx, GivenDefaultMenuViewInitWhenMenuCtxEnterWithNullContextThenNothingIsChanged)
+{
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    mock_reset_driver_call_counters();
+    // When
+    menu_ctx_enter(NULL);
+    // Then
+    TEST_ASSERT_EQUAL(&mock_menu_1, get_current_menu_position());
+    TEST_ASSERT_EQUAL(0, mock_cursor_position_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_print_string_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_print_char_call_counter);
+}
+
+TEST(menu_lib_ctx, GivenDefaultMenuViewInitWhenMenuCtxEscWithNullContextThenNothingIsChanged)
+{
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    mock_reset_driver_call_counters();
+    // When
+    menu_ctx_esc(NULL);
+    // Then
+    TEST_ASSERT_EQUAL(&mock_menu_1, get_current_menu_position());
+    TEST_ASSERT_EQUAL(0, mock_cursor_position_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_print_string_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_print_char_call_counter);
+}
+
+TEST(menu_lib_ctx, GivenDefaultMenuViewInitWhenMenuCtxMoveByWithNullContextThenNothingIsChanged)
+{
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    mock_reset_driver_call_counters();
+    // When
+    menu_ctx_move_by(NULL, 2);
+    // Then
+    TEST_ASSERT_EQUAL(&mock_menu_1, get_current_menu_position());
+    TEST_ASSERT_EQUAL(0, mock_cursor_position_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_print_string_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_print_char_call_counter);
+}
+
+TEST(menu_lib_ctx, GivenDefaultMenuViewInitWhenMenuCtxPageDownWithNullContextThenNothingIsChanged)
+{
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    mock_reset_driver_call_counters();
+    // When
+    menu_ctx_page_down(NULL);
+    // Then
+    TEST_ASSERT_EQUAL(&mock_menu_1, get_current_menu_position());
+    TEST_ASSERT_EQUAL(0, mock_cursor_position_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_print_string_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_print_char_call_counter);
+}
+
+TEST(menu_lib_ctx, GivenDefaultMenuViewInitWhenMenuCtxPageUpWithNullContextThenNothingIsChanged)
+{
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    mock_reset_driver_call_counters();
+    // When
+    menu_ctx_page_up(NULL);
+    // Then
+    TEST_ASSERT_EQUAL(&mock_menu_1, get_current_menu_position());
+    TEST_ASSERT_EQUAL(0, mock_cursor_position_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_print_string_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_print_char_call_counter);
+}
+
+TEST(menu_lib_ctx, GivenDefaultMenuViewInitWhenMenuCtxFirstWithNullContextThenNothingIsChanged)
+{
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    mock_reset_driver_call_counters();
+    // When
+    menu_ctx_first(NULL);
+    // Then
+    TEST_ASSERT_EQUAL(&mock_menu_1, get_current_menu_position());
+    TEST_ASSERT_EQUAL(0, mock_cursor_position_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_print_string_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_print_char_call_counter);
+}
+
+TEST(menu_lib_ctx, GivenDefaultMenuViewInitWhenMenuCtxLastWithNullContextThenNothingIsChanged)
+{
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    mock_reset_driver_call_counters();
+    // When
+    menu_ctx_last(NULL);
+    // Then
+    TEST_ASSERT_EQUAL(&mock_menu_1, get_current_menu_position());
+    TEST_ASSERT_EQUAL(0, mock_cursor_position_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_print_string_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_print_char_call_counter);
+}
+
+TEST(menu_lib_ctx, GivenDefaultMenuViewInitWhenMenuCtxUpdateScreenViewWithNullContextThenNothingIsChanged)
+{
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    mock_reset_driver_call_counters();
+    // When
+    menu_ctx_update_screen_view(NULL);
+    // Then
+    TEST_ASSERT_EQUAL(&mock_menu_1, get_current_menu_position());
+    TEST_ASSERT_EQUAL(0, mock_cursor_position_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_print_string_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_print_char_call_counter);
+}
+
+TEST(menu_lib_ctx, GivenDefaultMenuViewInitWhenMenuCtxSetRenderModeWithNullContextThenNothingIsChanged)
+{
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    mock_reset_driver_call_counters();
+    // When
+    menu_ctx_set_render_mode(NULL, MENU_RENDER_INCREMENTAL);
+    // Then
+    TEST_ASSERT_EQUAL(&mock_menu_1, get_current_menu_position());
+    TEST_ASSERT_EQUAL(0, mock_cursor_position_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_print_string_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_print_char_call_counter);
+}
+
+TEST(menu_lib_ctx, WhenMenuCtxGetCurrentMenuPositionWithNullContextThenReturnNoNode)
+{
+    // When
+    menu_ref_t position = menu_ctx_get_current_menu_position(NULL);
+    // Then
+    TEST_ASSERT_EQUAL(MENU_NO_NODE, position);
+}
+
+static void terminal_screen_init(void)
+{
+    for (uint8_t y = 0; y < TERMINAL_Y; y++)
+    {
+        memset(terminal_screen[y], ' ', TERMINAL_X);
+        terminal_screen[y][TERMINAL_X] = '\0';
+    }
+    terminal_cur_x = 0;
+    terminal_cur_y = 0;
+}
+
+static uint8_t terminal_get_number_of_screen_lines(void)
+{
+    return TERMINAL_Y;
+}
+
+static uint8_t terminal_get_number_of_chars_per_line(void)
+{
+    return TERMINAL_X;
+}
+
+static void terminal_cursor_position(uint8_t row, uint8_t column)
+{
+    terminal_cur_x = column;
+    terminal_cur_y = row;
+}
+
+static void terminal_print_string(const char *str)
+{
+    while (*str != '\0')
+    {
+        terminal_print_char(*str);
+        str++;
+    }
+}
+
+static void terminal_print_char(const char C)
+{
+    if ((terminal_cur_y < TERMINAL_Y) && (terminal_cur_x < TERMINAL_X))
+    {
+        terminal_screen[terminal_cur_y][terminal_cur_x] = C;
+    }
+    terminal_cur_x++;
+}
@@ -0,0 +1,194 @@
+#include "unity/fixture/unity_fixture.h"
+#include "menu_lib.h"
+#include "mock_menu_implementation.h"
+#include "mock_menu_screen_driver_interface.h"
+#include <stddef.h>
+
+TEST_GROUP(menu_lib_event_queue);
+
+TEST_SETUP(menu_lib_event_queue)
+{
+    /* Init before every test */
+    init_mock_row_screen_driver();
+    mock_set_callback_status_to_unknown();
+    set_top_level_exit_cb_status_to_unknown();
+}
+
+TEST_TEAR_DOWN(menu_lib_event_queue)
+{
+    /* Cleanup after every test */
+    init_mock_screen_driver();
+}
+
+TEST(menu_lib_event_queue, GivenMenuViewInitWhenNextEventsPostedThenScreenAndMenuPositionAreNotChanged)
+{
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    mock_reset_driver_call_counters();
+    // When
+    menu_post_event(MENU_EVENT_NEXT);
+    menu_post_event(MENU_EVENT_NEXT);
+    // Then
+    TEST_ASSERT_EQUAL(&mock_menu_1, get_current_menu_position());
+    TEST_ASSERT_EQUAL(0, mock_write_row_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_cursor_position_call_counter);
+}
+
+TEST(menu_lib_event_queue, GivenMenuViewInitAndEightNextEventsPostedWhenMenuProcessCalledThenViewIsRedrawnOnce)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        " menu_3             ",
+        " menu_4             ",
+        ">menu_5             "};
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    for (uint8_t i = 0U; i < MENU_EVENT_QUEUE_SIZE; i++)
+    {
+        menu_post_event(MENU_EVENT_NEXT);
+    }
+    mock_reset_driver_call_counters();
+    // When
+    menu_process();
+    // Then
+    TEST_ASSERT_EQUAL(&mock_menu_5, get_current_menu_position());
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+    TEST_ASSERT_EQUAL(LCD_Y, mock_write_row_call_counter);
+}
+
+TEST(menu_lib_event_queue, GivenMenuViewInitAndMixedEventsPostedWhenMenuProcessCalledThenScreenContentIsEqualToExpected)
+{
+    const char *expected_screen[4] = {
+        "------ menu_2 ------",
+        " menu_2_1           ",
+        ">menu_2_2           ",
+        " menu_2_3           "};
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    menu_post_event(MENU_EVENT_NEXT);
+    menu_post_event(MENU_EVENT_ENTER);
+    menu_post_event(MENU_EVENT_NEXT);
+    menu_post_event(MENU_EVENT_NEXT);
+    menu_post_event(MENU_EVENT_PREV);
+    // When
+    menu_process();
+    // Then
+    TEST_ASSERT_EQUAL(&mock_sub_menu_2_2, get_current_menu_position());
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_event_queue, GivenMenuViewInitAndNoEventPostedWhenMenuProcessCalledThenNoDriverCall)
+{
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    mock_reset_driver_call_counters();
+    // When
+    menu_process();
+    // Then
+    TEST_ASSERT_EQUAL(0, mock_write_row_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_cursor_position_call_counter);
+}
+
+TEST(menu_lib_event_queue, GivenQueueFilledWithEventsWhenMenuPostEventCalledThenReturnEventQueueFull)
+{
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    for (uint8_t i = 0U; i < MENU_EVENT_QUEUE_SIZE; i++)
+    {
+        TEST_ASSERT_EQUAL(MENU_OK, menu_post_event(MENU_EVENT_NEXT));
+    }
+    // When
+    menu_status_t status = menu_post_event(MENU_EVENT_NEXT);
+    // Then
+    TEST_ASSERT_EQUAL(MENU_ERR_EVENT_QUEUE_FULL, status);
+}
+
+TEST(menu_lib_event_queue, GivenFullQueueProcessedWhenMenuPostEventCalledThenReturnOk)
+{
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    for (uint8_t i = 0U; i < MENU_EVENT_QUEUE_SIZE; i++)
+    {
+        menu_post_event(MENU_EVENT_NEXT);
+    }
+    menu_process();
+    // When
+    menu_status_t status = menu_post_event(MENU_EVENT_PREV);
+    menu_process();
+    // Then
+    TEST_ASSERT_EQUAL(MENU_OK, status);
+    TEST_ASSERT_EQUAL(&mock_menu_4, get_current_menu_position());
+}
+
+TEST(menu_lib_event_queue, GivenEnterEventOnItemWithCallbackFollowedByNextEventWhenMenuProcessCalledThenCallbackIsExecutedAndNextEventIsDiscarded)
+{
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    menu_post_event(MENU_EVENT_ENTER);
+    menu_post_event(MENU_EVENT_ENTER);
+    menu_post_event(MENU_EVENT_NEXT);
+    // When
+    menu_process();
+    menu_process();
+    // Then
+    TEST_ASSERT_EQUAL(CB_EXECUTED, mock_menu_callback_status);
+    TEST_ASSERT_EQUAL(&mock_sub_menu_1_1, get_current_menu_position());
+    TEST_ASSERT_EQUAL_STRING("------ menu_1 ------", mock_screen_lines[0]);
+}
+
+TEST(menu_lib_event_queue, GivenMenuViewInitWithExitCallbackAndEscEventPostedWhenMenuProcessCalledThenTopLevelExitCallbackIsExecuted)
+{
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, mock_menu_top_level_exit_callback, NULL);
+    menu_post_event(MENU_EVENT_ESC);
+    // When
+    menu_process();
+    // Then
+    TEST_ASSERT_EQUAL(CB_EXECUTED, mock_menu_top_level_exit_cb_status);
+}
+
+TEST(menu_lib_event_queue, GivenIncrementalRenderModeAndSubmenuSwappedBySameLevelEventsWhenMenuProcessCalledThenNewSubmenuIsDrawn)
+{
+    const char *expected_screen[4] = {
+        "------ menu_2 ------",
+        ">menu_2_1           ",
+        " menu_2_2           ",
+        " menu_2_3           "};
+    // Given
+    menu_init();
+    menu_set_render_mode(MENU_RENDER_INCREMENTAL);
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    menu_enter();
+    menu_post_event(MENU_EVENT_ESC);
+    menu_post_event(MENU_EVENT_NEXT);
+    menu_post_event(MENU_EVENT_ENTER);
+    // When
+    menu_process();
+    // Then
+    TEST_ASSERT_EQUAL(&mock_sub_menu_2_1, get_current_menu_position());
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_event_queue, WhenMenuCtxPostEventWithNullContextThenReturnNoContext)
+{
+    // When
+    menu_status_t status = menu_ctx_post_event(NULL, MENU_EVENT_NEXT);
+    // Then
+    TEST_ASSERT_EQUAL(MENU_ERR_NO_CONTEXT, status);
+}
+
+TEST(menu_lib_event_queue, WhenMenuCtxProcessWithNullContextThenReturnNoContext)
+{
+    // When
+    menu_status_t status = menu_ctx_process(NULL);
+    // Then
+    TEST_ASSERT_EQUAL(MENU_ERR_NO_CONTEXT, status);
+}
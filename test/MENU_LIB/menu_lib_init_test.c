@@ -6,20 +6,20 @@
 #include <stddef.h>
 #include <stdbool.h>
 
-extern menu_t *menu_entry_point;
-extern uint8_t menu_number_of_chars_per_line;
-extern uint8_t menu_number_of_screen_lines;
-extern bool menu_initialized;
-extern const struct menu_screen_driver_interface_struct *DISPLAY;
+extern menu_ctx_t menu_default_ctx;
 
 // DISPLAY mock
 extern const struct menu_screen_driver_interface_struct mock_menu_screen_driver_interface;
 
+static menu_t chain_menu[MAX_MENU_DEPTH + 1];
+
+static void link_menu_level(menu_t *items, uint8_t items_qty, menu_t *parent);
+
 TEST_GROUP(menu_lib_init);
 
 TEST_SETUP(menu_lib_init)
 {
-    menu_initialized = false;
+    menu_default_ctx.initialized = false;
     init_mock_screen_driver();
 }
 TEST_TEAR_DOWN(menu_lib_init)
@@ -29,19 +29,19 @@ TEST_TEAR_DOWN(menu_lib_init)
 TEST(menu_lib_init, WhenMenuInitThenMenuScreenSizeEqualToPassedConfigDataColumnCountAndRowCount)
 {
     menu_init();
-    TEST_ASSERT_EQUAL(20, menu_number_of_chars_per_line);
-    TEST_ASSERT_EQUAL(4, menu_number_of_screen_lines);
+    TEST_ASSERT_EQUAL(20, menu_default_ctx.chars_per_line);
+    TEST_ASSERT_EQUAL(4, menu_default_ctx.screen_lines);
 }
 
 TEST(menu_lib_init, WhenMenuInitThenMenuScreenDriverInterfaceisEqualToMockMenuScreenDriverInterface)
 {
     menu_init();
-    TEST_ASSERT_EQUAL(DISPLAY, &mock_menu_screen_driver_interface);
+    TEST_ASSERT_EQUAL(menu_default_ctx.display, &mock_menu_screen_driver_interface);
 }
 
 TEST(menu_lib_init, WhenMenuViewInitWithoutInitThenReturnNotInitialized)
 {
-    menu_initialized = false;
+    menu_default_ctx.initialized = false;
     menu_t dummy_menu = {0};
     menu_status_t status = menu_view_init(&dummy_menu, NULL, NULL);
     TEST_ASSERT_EQUAL(MENU_ERR_NOT_INITIALIZED, status);
@@ -49,25 +49,139 @@ TEST(menu_lib_init, WhenMenuViewInitWithoutInitThenReturnNotInitialized)
 
 TEST(menu_lib_init, WhenMenuViewInitWithNullRootMenuThenReturnNoMenu)
 {
-    menu_initialized = true;
+    menu_default_ctx.initialized = true;
     menu_status_t status = menu_view_init(NULL, NULL, NULL);
     TEST_ASSERT_EQUAL(MENU_ERR_NO_MENU, status);
 }
 
 TEST(menu_lib_init, WhenMenuViewInitWithTooDeepMenuThenReturnMenuDepthTooShallow)
 {
-    menu_initialized = true;
+    menu_default_ctx.initialized = true;
     static menu_t deep_menu[MAX_MENU_DEPTH + 1];
     for (int i = 0; i <= MAX_MENU_DEPTH; i++)
+    {
         deep_menu[i].child = (i < MAX_MENU_DEPTH) ? &deep_menu[i + 1] : NULL;
+        deep_menu[i].parent = (i > 0) ? &deep_menu[i - 1] : NULL;
+    }
 
     menu_status_t status = menu_view_init(&deep_menu[0], NULL, NULL);
     TEST_ASSERT_EQUAL(MENU_ERR_MENU_TOO_DEEP, status);
 }
 
+TEST(menu_lib_init, GivenSecondTopLevelItemWithTooDeepSubmenuWhenMenuViewInitThenReturnMenuTooDeep)
+{
+    static menu_t top_menu[2];
+    // Given
+    menu_init();
+    link_menu_level(top_menu, 2U, NULL);
+    link_menu_level(chain_menu, 1U, &top_menu[1]);
+    for (uint8_t i = 1U; i <= MAX_MENU_DEPTH; i++)
+    {
+        link_menu_level(&chain_menu[i], 1U, &chain_menu[i - 1U]);
+    }
+    // When
+    menu_status_t status = menu_view_init(&top_menu[0], NULL, NULL);
+    // Then
+    TEST_ASSERT_EQUAL(MENU_ERR_MENU_TOO_DEEP, status);
+}
+
+TEST(menu_lib_init, GivenMenuWithNextItemPointingBackToFirstItemWhenMenuViewInitThenReturnMalformedMenu)
+{
+    static menu_t looped_menu[3];
+    // Given
+    menu_init();
+    link_menu_level(looped_menu, 3U, NULL);
+    looped_menu[2].next = &looped_menu[0];
+    // When
+    menu_status_t status = menu_view_init(&looped_menu[0], NULL, NULL);
+    // Then
+    TEST_ASSERT_EQUAL(MENU_ERR_MALFORMED_MENU, status);
+}
+
+TEST(menu_lib_init, GivenSubmenuItemWithWrongPrevLinkWhenMenuViewInitThenReturnMalformedMenu)
+{
+    static menu_t top_menu[2];
+    static menu_t sub_menu[3];
+    // Given
+    menu_init();
+    link_menu_level(top_menu, 2U, NULL);
+    link_menu_level(sub_menu, 3U, &top_menu[1]);
+    sub_menu[2].prev = &sub_menu[0];
+    // When
+    menu_status_t status = menu_view_init(&top_menu[0], NULL, NULL);
+    // Then
+    TEST_ASSERT_EQUAL(MENU_ERR_MALFORMED_MENU, status);
+}
+
+TEST(menu_lib_init, GivenSubmenuItemWithWrongParentLinkWhenMenuViewInitThenReturnMalformedMenu)
+{
+    static menu_t top_menu[2];
+    static menu_t sub_menu[2];
+    // Given
+    menu_init();
+    link_menu_level(top_menu, 2U, NULL);
+    link_menu_level(sub_menu, 2U, &top_menu[0]);
+    sub_menu[1].parent = &top_menu[1];
+    // When
+    menu_status_t status = menu_view_init(&top_menu[0], NULL, NULL);
+    // Then
+    TEST_ASSERT_EQUAL(MENU_ERR_MALFORMED_MENU, status);
+}
+
+TEST(menu_lib_init, GivenSubmenuItemWithChildPointingToTopLevelItemWhenMenuViewInitThenReturnMalformedMenu)
+{
+    static menu_t top_menu[2];
+    static menu_t sub_menu[2];
+    // Given
+    menu_init();
+    link_menu_level(top_menu, 2U, NULL);
+    link_menu_level(sub_menu, 2U, &top_menu[0]);
+    sub_menu[1].child = &top_menu[0];
+    // When
+    menu_status_t status = menu_view_init(&top_menu[0], NULL, NULL);
+    // Then
+    TEST_ASSERT_EQUAL(MENU_ERR_MALFORMED_MENU, status);
+}
+
+TEST(menu_lib_init, GivenValidatedMenuBrokenAfterwardsWhenMenuViewInitAgainThenTreeIsNotWalkedUntilValidatedMenusAreCleared)
+{
+    static menu_t top_menu[2];
+    static menu_t sub_menu[2];
+    // Given
+    menu_init();
+    link_menu_level(top_menu, 2U, NULL);
+    link_menu_level(sub_menu, 2U, &top_menu[1]);
+    TEST_ASSERT_EQUAL(MENU_OK, menu_view_init(&top_menu[0], NULL, NULL));
+    sub_menu[1].parent = NULL;
+    // When
+    menu_status_t cached_status = menu_view_init(&top_menu[0], NULL, NULL);
+    menu_clear_validated_menus();
+    menu_status_t status = menu_view_init(&top_menu[0], NULL, NULL);
+    // Then
+    TEST_ASSERT_EQUAL(MENU_OK, cached_status);
+    TEST_ASSERT_EQUAL(MENU_ERR_MALFORMED_MENU, status);
+}
+
+TEST(menu_lib_init, GivenMoreValidatedMenusThanRememberedWhenMenuViewInitWithFirstMenuThenItIsValidatedAgain)
+{
+    static menu_t single_menus[MENU_VALIDATED_MENUS_QTY + 1U];
+    // Given
+    menu_init();
+    for (uint8_t i = 0U; i <= MENU_VALIDATED_MENUS_QTY; i++)
+    {
+        link_menu_level(&single_menus[i], 1U, NULL);
+        TEST_ASSERT_EQUAL(MENU_OK, menu_view_init(&single_menus[i], NULL, NULL));
+    }
+    single_menus[0].prev = &single_menus[1];
+    // When
+    menu_status_t status = menu_view_init(&single_menus[0], NULL, NULL);
+    // Then
+    TEST_ASSERT_EQUAL(MENU_ERR_MALFORMED_MENU, status);
+}
+
 TEST(menu_lib_init, WhenMenuViewInitWithValidMenuThenReturnOk)
 {
-    menu_initialized = true;
+    menu_default_ctx.initialized = true;
     menu_t valid_menu = {0};
     valid_menu.name = "Root";
 
@@ -80,9 +194,9 @@ TEST(menu_lib_init, WhenMenuInitThenReturnOk)
 {
     menu_status_t status = menu_init();
     TEST_ASSERT_EQUAL(MENU_OK, status);
-    TEST_ASSERT_EQUAL(&mock_menu_screen_driver_interface, DISPLAY);
-    TEST_ASSERT_EQUAL(DISPLAY->get_number_of_chars_per_line(), menu_number_of_chars_per_line);
-    TEST_ASSERT_EQUAL(DISPLAY->get_number_of_screen_lines(), menu_number_of_screen_lines);
+    TEST_ASSERT_EQUAL(&mock_menu_screen_driver_interface, menu_default_ctx.display);
+    TEST_ASSERT_EQUAL(menu_default_ctx.display->get_number_of_chars_per_line(), menu_default_ctx.chars_per_line);
+    TEST_ASSERT_EQUAL(menu_default_ctx.display->get_number_of_screen_lines(), menu_default_ctx.screen_lines);
 }
 
 TEST(menu_lib_init, GivenMockMenuScreenInitStatusEqualMenuScreenInitUnknownWhenInitWithValidDisplayThenMockScreenInitStatusEqualMenuScreenInitOk)
@@ -97,10 +211,10 @@ TEST(menu_lib_init, WhenInitWithValidDisplayThenReturnOk)
     menu_status_t status = menu_init();
 
     TEST_ASSERT_EQUAL(MENU_OK, status);
-    TEST_ASSERT_EQUAL(&mock_menu_screen_driver_interface, DISPLAY);
-    TEST_ASSERT_EQUAL(DISPLAY->get_number_of_chars_per_line(), menu_number_of_chars_per_line);
-    TEST_ASSERT_EQUAL(DISPLAY->get_number_of_screen_lines(), menu_number_of_screen_lines);
-    TEST_ASSERT_TRUE(menu_initialized);
+    TEST_ASSERT_EQUAL(&mock_menu_screen_driver_interface, menu_default_ctx.display);
+    TEST_ASSERT_EQUAL(menu_default_ctx.display->get_number_of_chars_per_line(), menu_default_ctx.chars_per_line);
+    TEST_ASSERT_EQUAL(menu_default_ctx.display->get_number_of_screen_lines(), menu_default_ctx.screen_lines);
+    TEST_ASSERT_TRUE(menu_default_ctx.initialized);
 }
 
 TEST(menu_lib_init, WhenInitWithNullDisplayThenReturnNoDisplayInterface)
@@ -113,7 +227,7 @@ TEST(menu_lib_init, WhenInitWithNullDisplayThenReturnNoDisplayInterface)
 
     // then
     TEST_ASSERT_EQUAL(MENU_ERR_NO_DISPLAY_INTERFACE, status);
-    TEST_ASSERT_FALSE(menu_initialized);
+    TEST_ASSERT_FALSE(menu_default_ctx.initialized);
 }
 
 TEST(menu_lib_init, WhenInitWithIncompleteDisplayThenReturnIncompleteInterface)
@@ -127,8 +241,24 @@ TEST(menu_lib_init, WhenInitWithIncompleteDisplayThenReturnIncompleteInterface)
 
     // then
     TEST_ASSERT_EQUAL(MENU_ERR_INCOMPLETE_INTERFACE, status);
-    TEST_ASSERT_FALSE(menu_initialized);
+    TEST_ASSERT_FALSE(menu_default_ctx.initialized);
 
     // przywrócenie poprawnego mocka
     init_mock_screen_driver();
 }
+
+static void link_menu_level(menu_t *items, uint8_t items_qty, menu_t *parent)
+{
+    for (uint8_t i = 0U; i < items_qty; i++)
+    {
+        items[i].name = "item";
+        items[i].next = (i < (items_qty - 1U)) ? &items[i + 1U] : NULL;
+        items[i].prev = (i > 0U) ? &items[i - 1U] : NULL;
+        items[i].child = NULL;
+        items[i].parent = parent;
+    }
+    if (parent != NULL)
+    {
+        parent->child = &items[0];
+    }
+}
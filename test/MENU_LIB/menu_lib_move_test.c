@@ -0,0 +1,150 @@
+#include "unity/fixture/unity_fixture.h"
+#include "menu_lib.h"
+#include "mock_menu_implementation.h"
+#include "mock_menu_screen_driver_interface.h"
+#include <stddef.h>
+
+TEST_GROUP(menu_lib_move);
+
+TEST_SETUP(menu_lib_move)
+{
+    /* Init before every test */
+    init_mock_row_screen_driver();
+}
+
+TEST_TEAR_DOWN(menu_lib_move)
+{
+    /* Cleanup after every test */
+    init_mock_screen_driver();
+}
+
+TEST(menu_lib_move, GivenMenuViewInitWhenMenuMoveBy3CalledThenScreenContentIsEqualToExpectedAndViewIsRedrawnOnce)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        " menu_2             ",
+        " menu_3             ",
+        ">menu_4             "};
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    mock_reset_driver_call_counters();
+    // When
+    menu_move_by(3);
+    // Then
+    TEST_ASSERT_EQUAL(&mock_menu_4, get_current_menu_position());
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+    TEST_ASSERT_EQUAL(LCD_Y, mock_write_row_call_counter);
+}
+
+TEST(menu_lib_move, GivenMenuNextCalled4TimesWhenMenuMoveByMinus3CalledThenScreenContentIsEqualToExpected)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        ">menu_2             ",
+        " menu_3             ",
+        " menu_4             "};
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    for (uint8_t i = 0U; i < 4U; i++)
+    {
+        menu_next();
+    }
+    // When
+    menu_move_by(-3);
+    // Then
+    TEST_ASSERT_EQUAL(&mock_menu_2, get_current_menu_position());
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_move, GivenMenuViewInitWhenMenuMoveByMoreThanItemsCalledThenLastItemIsSelected)
+{
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    // When
+    menu_move_by(50);
+    // Then
+    TEST_ASSERT_EQUAL(&mock_menu_5, get_current_menu_position());
+}
+
+TEST(menu_lib_move, GivenMenuViewInitWhenMenuMoveBy0CalledThenNoDriverCall)
+{
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    mock_reset_driver_call_counters();
+    // When
+    menu_move_by(0);
+    menu_move_by(-1);
+    // Then
+    TEST_ASSERT_EQUAL(&mock_menu_1, get_current_menu_position());
+    TEST_ASSERT_EQUAL(0, mock_write_row_call_counter);
+}
+
+TEST(menu_lib_move, GivenMenuViewInitWhenMenuPageDownCalledThenCursorMovesByMenuRowsQty)
+{
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    // When
+    menu_page_down();
+    // Then
+    TEST_ASSERT_EQUAL(&mock_menu_4, get_current_menu_position());
+}
+
+TEST(menu_lib_move, GivenMenuPageDownCalledWhenMenuPageUpCalledThenScreenContentIsEqualToExpected)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        ">menu_1             ",
+        " menu_2             ",
+        " menu_3             "};
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    menu_page_down();
+    // When
+    menu_page_up();
+    // Then
+    TEST_ASSERT_EQUAL(&mock_menu_1, get_current_menu_position());
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_move, GivenMenuNextCalledWhenMenuEnterAndMenuLastCalledThenScreenContentIsEqualToExpected)
+{
+    const char *expected_screen[4] = {
+        "------ menu_2 ------",
+        " menu_2_2           ",
+        " menu_2_3           ",
+        ">menu_2_4           "};
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    menu_next();
+    menu_enter();
+    // When
+    menu_last();
+    // Then
+    TEST_ASSERT_EQUAL(&mock_sub_menu_2_4, get_current_menu_position());
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_move, GivenMenuLastCalledWhenMenuFirstCalledThenScreenContentIsEqualToExpected)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        ">menu_1             ",
+        " menu_2             ",
+        " menu_3             "};
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    menu_last();
+    // When
+    menu_first();
+    // Then
+    TEST_ASSERT_EQUAL(&mock_menu_1, get_current_menu_position());
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
@@ -0,0 +1,128 @@
+#include "unity/fixture/unity_fixture.h"
+#include "menu_lib.h"
+#include "mock_menu_implementation.h"
+#include "mock_menu_screen_driver_interface.h"
+#include "profiling_screen_driver.h"
+#include <stddef.h>
+
+static menu_ctx_t profiling_ctx;
+
+static uint64_t get_menu_next_bus_time_ns(const profiling_cost_model_t *model);
+
+TEST_GROUP(menu_lib_profiling);
+
+TEST_SETUP(menu_lib_profiling)
+{
+    /* Init before every test */
+    init_mock_screen_driver();
+}
+
+TEST_TEAR_DOWN(menu_lib_profiling)
+{
+    /* Cleanup after every test */
+    init_mock_screen_driver();
+}
+
+TEST(menu_lib_profiling, GivenProfilingDriverWrappingMockDriverWhenMenuCtxViewInitThenScreenIsDrawnAndEveryCallIsTraced)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        ">menu_1             ",
+        " menu_2             ",
+        " menu_3             "};
+    // Given
+    menu_ctx_init(&profiling_ctx, profiling_driver_init(get_menu_display_driver_interface(), &profiling_vt100_uart_model));
+    mock_reset_driver_call_counters();
+    // When
+    menu_ctx_view_init(&profiling_ctx, &mock_menu_1, NULL, NULL);
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+    TEST_ASSERT_EQUAL(0, profiling_trace_dropped);
+    TEST_ASSERT_EQUAL(PROFILING_OP_CURSOR_POSITION, profiling_trace[0].op);
+    TEST_ASSERT_EQUAL(0, profiling_trace[0].row);
+    TEST_ASSERT_EQUAL(0, profiling_trace[0].column);
+    TEST_ASSERT_EQUAL(mock_cursor_position_call_counter, profiling_count_ops(PROFILING_OP_CURSOR_POSITION));
+    TEST_ASSERT_EQUAL(mock_print_string_call_counter, profiling_count_ops(PROFILING_OP_PRINT_STRING));
+    TEST_ASSERT_EQUAL(mock_print_char_call_counter, profiling_count_ops(PROFILING_OP_PRINT_CHAR));
+}
+
+TEST(menu_lib_profiling, GivenMenuCtxViewInitWhenMenuCtxNextThenBusTimeIsEqualToSumOfTracedCallCosts)
+{
+    uint64_t traced_cost_ns = 0U;
+    // Given
+    menu_ctx_init(&profiling_ctx, profiling_driver_init(get_menu_display_driver_interface(), &profiling_vt100_uart_model));
+    menu_ctx_view_init(&profiling_ctx, &mock_menu_1, NULL, NULL);
+    profiling_reset_trace();
+    // When
+    menu_ctx_next(&profiling_ctx);
+    // Then
+    for (uint16_t i = 0U; i < profiling_trace_len; i++)
+    {
+        traced_cost_ns += profiling_trace[i].cost_ns;
+    }
+    TEST_ASSERT_EQUAL(0, profiling_trace_dropped);
+    TEST_ASSERT_TRUE(traced_cost_ns == profiling_get_bus_time_ns());
+}
+
+TEST(menu_lib_profiling, GivenHd44780BusyFlagModelAndRowWriteDriverWhenMenuCtxNextThenBusTimeStaysUnder4ms)
+{
+    // Given
+    init_mock_row_screen_driver();
+    // When
+    uint64_t bus_time_ns = get_menu_next_bus_time_ns(&profiling_hd44780_busy_flag_model);
+    // Then
+    TEST_ASSERT_EQUAL(LCD_Y, profiling_count_ops(PROFILING_OP_WRITE_ROW));
+    TEST_ASSERT_TRUE(bus_time_ns < 4000000U);
+}
+
+TEST(menu_lib_profiling, GivenPcf8574ModelWhenMenuCtxNextThenRowWriteDriverBusTimeIsLowerThanPerCharDriverBusTime)
+{
+    // Given
+    uint64_t per_char_bus_time_ns = get_menu_next_bus_time_ns(&profiling_pcf8574_i2c_model);
+    init_mock_row_screen_driver();
+    // When
+    uint64_t row_write_bus_time_ns = get_menu_next_bus_time_ns(&profiling_pcf8574_i2c_model);
+    // Then
+    TEST_ASSERT_TRUE(row_write_bus_time_ns < per_char_bus_time_ns);
+}
+
+TEST(menu_lib_profiling, GivenSameNavigationWhenPricedWithFixedDelayModelThenBusTimeIsHigherThanWithBusyFlagModel)
+{
+    // Given
+    uint64_t busy_flag_bus_time_ns = get_menu_next_bus_time_ns(&profiling_hd44780_busy_flag_model);
+    // When
+    uint64_t fixed_delay_bus_time_ns = get_menu_next_bus_time_ns(&profiling_hd44780_fixed_delay_model);
+    // Then
+    TEST_ASSERT_TRUE(fixed_delay_bus_time_ns > busy_flag_bus_time_ns);
+}
+
+TEST(menu_lib_profiling, GivenFullTraceWhenNextCallsRecordedThenCallsAreCountedAsDroppedAndStillPriced)
+{
+    // Given
+    menu_ctx_init(&profiling_ctx, profiling_driver_init(get_menu_display_driver_interface(), &profiling_hd44780_busy_flag_model));
+    menu_ctx_view_init(&profiling_ctx, &mock_menu_1, NULL, NULL);
+    profiling_reset_trace();
+    // When
+    for (uint8_t i = 0U; i < 10U; i++)
+    {
+        menu_ctx_next(&profiling_ctx);
+    }
+    // Then
+    uint64_t traced_cost_ns = 0U;
+    for (uint16_t i = 0U; i < profiling_trace_len; i++)
+    {
+        traced_cost_ns += profiling_trace[i].cost_ns;
+    }
+    TEST_ASSERT_EQUAL(PROFILING_TRACE_SIZE, profiling_trace_len);
+    TEST_ASSERT_TRUE(profiling_trace_dropped > 0U);
+    TEST_ASSERT_TRUE(profiling_get_bus_time_ns() > traced_cost_ns);
+}
+
+static uint64_t get_menu_next_bus_time_ns(const profiling_cost_model_t *model)
+{
+    menu_ctx_init(&profiling_ctx, profiling_driver_init(get_menu_display_driver_interface(), model));
+    menu_ctx_view_init(&profiling_ctx, &mock_menu_1, NULL, NULL);
+    profiling_reset_trace();
+    menu_ctx_next(&profiling_ctx);
+    return profiling_get_bus_time_ns();
+}
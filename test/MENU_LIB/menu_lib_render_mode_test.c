@@ -0,0 +1,128 @@
+#include "unity/fixture/unity_fixture.h"
+#include "menu_lib.h"
+#include "mock_menu_implementation.h"
+#include "menu_screen_driver_interface.h"
+#include "mock_menu_screen_driver_interface.h"
+#include <stddef.h>
+
+TEST_GROUP(menu_lib_render_mode);
+
+TEST_SETUP(menu_lib_render_mode)
+{
+    /* Init before every test */
+    init_mock_screen_driver();
+    menu_init();
+    menu_set_render_mode(MENU_RENDER_INCREMENTAL);
+}
+
+TEST_TEAR_DOWN(menu_lib_render_mode)
+{
+    /* Cleanup after every test */
+    menu_set_render_mode(MENU_RENDER_FULL);
+}
+
+TEST(menu_lib_render_mode, GivenIncrementalRenderModeAndMenuViewInitWhenMenuNextCalledThenOnlyCursorCellsAreRewritten)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        " menu_1             ",
+        ">menu_2             ",
+        " menu_3             "};
+    // Given
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    mock_reset_driver_call_counters();
+    // When
+    menu_next();
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+    TEST_ASSERT_EQUAL(2, mock_print_char_call_counter);
+    TEST_ASSERT_EQUAL(2, mock_cursor_position_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_print_string_call_counter);
+}
+
+TEST(menu_lib_render_mode, GivenIncrementalRenderModeAndMenuNextCalledTwiceWhenMenuPrevCalledThenOnlyCursorCellsAreRewritten)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        " menu_1             ",
+        ">menu_2             ",
+        " menu_3             "};
+    // Given
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    menu_next();
+    menu_next();
+    mock_reset_driver_call_counters();
+    // When
+    menu_prev();
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+    TEST_ASSERT_EQUAL(2, mock_print_char_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_print_string_call_counter);
+}
+
+TEST(menu_lib_render_mode, GivenIncrementalRenderModeAndMenuNextCalledTwiceWhenMenuNextCalledThenWindowScrollsWithFullRedraw)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        " menu_2             ",
+        " menu_3             ",
+        ">menu_4             "};
+    // Given
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    menu_next();
+    menu_next();
+    mock_reset_driver_call_counters();
+    // When
+    menu_next();
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+    TEST_ASSERT_EQUAL(4, mock_print_string_call_counter);
+}
+
+TEST(menu_lib_render_mode, GivenIncrementalRenderModeAndMenuNextCalledWhenMenuEnterAndMenuEscCalledThenScreenContentIsEqualToExpected)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        " menu_1             ",
+        ">menu_2             ",
+        " menu_3             "};
+    // Given
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    menu_next();
+    // When
+    menu_enter();
+    menu_next();
+    menu_esc();
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_render_mode, GivenIncrementalRenderModeAndScreenClearedByApplicationWhenUpdateScreenViewCalledThenFullViewIsRedrawn)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        " menu_1             ",
+        ">menu_2             ",
+        " menu_3             "};
+    // Given
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    menu_next();
+    get_menu_display_driver_interface()->clr_scr();
+    // When
+    update_screen_view();
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_render_mode, GivenFullRenderModeAndMenuViewInitWhenMenuNextCalledThenWholeViewIsRedrawn)
+{
+    // Given
+    menu_set_render_mode(MENU_RENDER_FULL);
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    mock_reset_driver_call_counters();
+    // When
+    menu_next();
+    // Then
+    TEST_ASSERT_EQUAL(4, mock_print_string_call_counter);
+    TEST_ASSERT_TRUE(mock_print_char_call_counter > 2);
+}
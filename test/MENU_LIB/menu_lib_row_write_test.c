@@ -0,0 +1,184 @@
+#include "unity/fixture/unity_fixture.h"
+#include "menu_lib.h"
+#include "mock_menu_implementation.h"
+#include "mock_menu_screen_driver_interface.h"
+#include <stddef.h>
+
+TEST_GROUP(menu_lib_row_write);
+
+TEST_SETUP(menu_lib_row_write)
+{
+    /* Init before every test */
+    init_mock_row_screen_driver();
+}
+
+TEST_TEAR_DOWN(menu_lib_row_write)
+{
+    /* Cleanup after every test */
+    menu_set_render_mode(MENU_RENDER_FULL);
+    init_mock_screen_driver();
+}
+
+TEST(menu_lib_row_write, GivenMenuInitWithRowWriteDriverWhenMenuViewInitCalledThenScreenContentIsEqualToExpected)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        ">menu_1             ",
+        " menu_2             ",
+        " menu_3             "};
+    // Given
+    menu_init();
+    // When
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_row_write, GivenMenuInitWithRowWriteDriverWhenMenuViewInitCalledThenOneWriteRowCallPerRowAndNoOtherDriverCalls)
+{
+    // Given
+    menu_init();
+    mock_reset_driver_call_counters();
+    // When
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    // Then
+    TEST_ASSERT_EQUAL(LCD_Y, mock_write_row_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_fill_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_cursor_position_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_print_string_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_print_char_call_counter);
+}
+
+TEST(menu_lib_row_write, GivenMenuInitWithRowWriteDriverAndCustomHeaderWhenMenuViewInitCalledThenHeaderIsCentered)
+{
+    const char *expected_screen[4] = {
+        "----- SETTINGS -----",
+        ">menu_1             ",
+        " menu_2             ",
+        " menu_3             "};
+    // Given
+    menu_init();
+    // When
+    menu_view_init(&mock_menu_1, NULL, " SETTINGS ");
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_row_write, GivenMenuInitWithRowWriteDriverAndMenuNextCalledWhenMenuEnterCalledThenScreenContentIsEqualToExpected)
+{
+    const char *expected_screen[4] = {
+        "------ menu_2 ------",
+        ">menu_2_1           ",
+        " menu_2_2           ",
+        " menu_2_3           "};
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    menu_next();
+    // When
+    menu_enter();
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_row_write, GivenMenuInitWithRowWriteDriverAndMenuNextCalled4TimesWhenMenuPrevCalledOnceThenScreenContentIsEqualToExpected)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        " menu_3             ",
+        ">menu_4             ",
+        " menu_5             "};
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    for (uint8_t i = 0U; i < 4U; i++)
+    {
+        menu_next();
+    }
+    // When
+    menu_prev();
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_row_write, GivenMenuInitWithRowWriteDriverAndIncrementalRenderModeWhenMenuNextCalledWithoutScrollThenNoWriteRowCall)
+{
+    // Given
+    menu_init();
+    menu_set_render_mode(MENU_RENDER_INCREMENTAL);
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    mock_reset_driver_call_counters();
+    // When
+    menu_next();
+    // Then
+    TEST_ASSERT_EQUAL(0, mock_write_row_call_counter);
+    TEST_ASSERT_EQUAL(2, mock_print_char_call_counter);
+}
+
+TEST(menu_lib_row_write, GivenMenuInitWithFillDriverWhenMenuViewInitCalledThenScreenContentIsEqualToExpected)
+{
+    const char *expected_screen[4] = {
+        "------ menu_2 ------",
+        ">menu_2_1           ",
+        " menu_2_2           ",
+        " menu_2_3           "};
+    // Given
+    init_mock_fill_screen_driver();
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    menu_next();
+    // When
+    menu_enter();
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_row_write, GivenMenuInitWithFillDriverWhenMenuViewInitCalledThenHeaderIsPrintedAsOneStringAndClearUsesOneFillCallPerRow)
+{
+    // Given
+    init_mock_fill_screen_driver();
+    menu_init();
+    mock_reset_driver_call_counters();
+    // When
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    // Then
+    TEST_ASSERT_EQUAL(LCD_Y - 1, mock_fill_call_counter);
+    TEST_ASSERT_EQUAL(LCD_Y, mock_print_string_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_write_row_call_counter);
+    TEST_ASSERT_EQUAL(1, mock_print_char_call_counter);
+}
+
+TEST(menu_lib_row_write, GivenMenuInitWithPerCharDriverAndMenuNextCalledWhenMenuEnterCalledThenSubMenuHeaderIsPrintedWithOnePrintStringCall)
+{
+    const char *expected_header = "------ menu_2 ------";
+    // Given
+    init_mock_screen_driver();
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    menu_next();
+    mock_reset_driver_call_counters();
+    // When
+    menu_enter();
+    // Then
+    TEST_ASSERT_EQUAL_STRING(expected_header, mock_screen_lines[0]);
+    /* header + 3 menu items */
+    TEST_ASSERT_EQUAL(LCD_Y, mock_print_string_call_counter);
+    /* 3 cleared rows + cursor marker */
+    TEST_ASSERT_EQUAL(((LCD_Y - 1) * LCD_X) + 1, mock_print_char_call_counter);
+}
+
+TEST(menu_lib_row_write, GivenSubMenuEnteredAndLeftWhenOtherSubMenuEnteredThenHeaderShowsNewParentName)
+{
+    const char *expected_header = "------ menu_3 ------";
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, " SETTINGS ");
+    menu_next();
+    menu_enter();
+    menu_esc();
+    menu_next();
+    // When
+    menu_enter();
+    // Then
+    TEST_ASSERT_EQUAL_STRING(expected_header, mock_screen_lines[0]);
+}
@@ -910,7 +910,7 @@ TEST(menu_lib, GivenMenuInitWith2004ScreenAndMenuViewInitForMockMenuAndMenuNextC
     menu_view_init(&mock_menu_1, NULL, NULL);
     call_menu_fun_x_times(menu_next, menu_next_repetition_counter);
     // When
-    menu_t *readed_menu_pos = get_current_menu_position();
+    const menu_t *readed_menu_pos = get_current_menu_position();
     // Then
     TEST_ASSERT_EQUAL(&mock_menu_3, readed_menu_pos);
 }
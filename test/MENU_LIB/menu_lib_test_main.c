@@ -13,4 +13,10 @@ static void run_all_tests(void)
 {
     RUN_TEST_GROUP(menu_lib_init);
     RUN_TEST_GROUP(menu_lib);
+    RUN_TEST_GROUP(menu_lib_render_mode);
+    RUN_TEST_GROUP(menu_lib_ctx);
+    RUN_TEST_GROUP(menu_lib_row_write);
+    RUN_TEST_GROUP(menu_lib_event_queue);
+    RUN_TEST_GROUP(menu_lib_move);
+    RUN_TEST_GROUP(menu_lib_profiling);
 }
\ No newline at end of file
@@ -11,6 +11,13 @@ TEST_GROUP_RUNNER(menu_lib_init)
     RUN_TEST_CASE(menu_lib_init, WhenMenuViewInitWithoutInitThenReturnNotInitialized);
     RUN_TEST_CASE(menu_lib_init, WhenMenuViewInitWithNullRootMenuThenReturnNoMenu);
     RUN_TEST_CASE(menu_lib_init, WhenMenuViewInitWithTooDeepMenuThenReturnMenuDepthTooShallow);
+    RUN_TEST_CASE(menu_lib_init, GivenSecondTopLevelItemWithTooDeepSubmenuWhenMenuViewInitThenReturnMenuTooDeep);
+    RUN_TEST_CASE(menu_lib_init, GivenMenuWithNextItemPointingBackToFirstItemWhenMenuViewInitThenReturnMalformedMenu);
+    RUN_TEST_CASE(menu_lib_init, GivenSubmenuItemWithWrongPrevLinkWhenMenuViewInitThenReturnMalformedMenu);
+    RUN_TEST_CASE(menu_lib_init, GivenSubmenuItemWithWrongParentLinkWhenMenuViewInitThenReturnMalformedMenu);
+    RUN_TEST_CASE(menu_lib_init, GivenSubmenuItemWithChildPointingToTopLevelItemWhenMenuViewInitThenReturnMalformedMenu);
+    RUN_TEST_CASE(menu_lib_init, GivenValidatedMenuBrokenAfterwardsWhenMenuViewInitAgainThenTreeIsNotWalkedUntilValidatedMenusAreCleared);
+    RUN_TEST_CASE(menu_lib_init, GivenMoreValidatedMenusThanRememberedWhenMenuViewInitWithFirstMenuThenItIsValidatedAgain);
     RUN_TEST_CASE(menu_lib_init, WhenMenuViewInitWithValidMenuThenReturnOk);
 
     RUN_TEST_CASE(menu_lib_init, WhenInitWithValidDisplayThenReturnOk);
@@ -88,3 +95,91 @@ TEST_GROUP_RUNNER(menu_lib)
     RUN_TEST_CASE(menu_lib, GivenMenuInitWith2004ScreenAndMenuViewInitForMockMenuAndMenuNextCalled2TimesWhenGetCurrentMenuPositionCalledThenReturnetValueIsEqualToMockMenu3);
     // important to check if enter scrren are same as exit screen (menu view and cursor position)
 }
+
+TEST_GROUP_RUNNER(menu_lib_render_mode)
+{
+    RUN_TEST_CASE(menu_lib_render_mode, GivenIncrementalRenderModeAndMenuViewInitWhenMenuNextCalledThenOnlyCursorCellsAreRewritten);
+    RUN_TEST_CASE(menu_lib_render_mode, GivenIncrementalRenderModeAndMenuNextCalledTwiceWhenMenuPrevCalledThenOnlyCursorCellsAreRewritten);
+    RUN_TEST_CASE(menu_lib_render_mode, GivenIncrementalRenderModeAndMenuNextCalledTwiceWhenMenuNextCalledThenWindowScrollsWithFullRedraw);
+    RUN_TEST_CASE(menu_lib_render_mode, GivenIncrementalRenderModeAndMenuNextCalledWhenMenuEnterAndMenuEscCalledThenScreenContentIsEqualToExpected);
+    RUN_TEST_CASE(menu_lib_render_mode, GivenIncrementalRenderModeAndScreenClearedByApplicationWhenUpdateScreenViewCalledThenFullViewIsRedrawn);
+    RUN_TEST_CASE(menu_lib_render_mode, GivenFullRenderModeAndMenuViewInitWhenMenuNextCalledThenWholeViewIsRedrawn);
+}
+
+TEST_GROUP_RUNNER(menu_lib_ctx)
+{
+    RUN_TEST_CASE(menu_lib_ctx, WhenMenuCtxInitWithNullContextThenReturnNoContext);
+    RUN_TEST_CASE(menu_lib_ctx, WhenMenuCtxInitWithNullDisplayThenReturnNoDisplayInterfaceAndViewInitReturnNotInitialized);
+    RUN_TEST_CASE(menu_lib_ctx, GivenTerminalCtxInitWith1602ScreenWhenMenuCtxViewInitCalledThenTerminalScreenContentIsEqualToExpected);
+    RUN_TEST_CASE(menu_lib_ctx, GivenPanelCtxAndTerminalCtxInitWithSameMenuWhenNavigatedIndependentlyThenEachCtxKeepsItsOwnPositionAndScreen);
+    RUN_TEST_CASE(menu_lib_ctx, GivenDefaultMenuViewInitWhenOtherCtxNavigatedThenGetCurrentMenuPositionIsNotChanged);
+    RUN_TEST_CASE(menu_lib_ctx, GivenDefaultMenuViewInitWhenMenuCtxNextWithNullContextThenNothingIsChanged);
+    RUN_TEST_CASE(menu_lib_ctx, GivenDefaultMenuViewInitWhenMenuCtxPrevWithNullContextThenNothingIsChanged);
+    RUN_TEST_CASE(menu_lib_ctx, GivenDefaultMenuViewInitWhenMenuCtxEnterWithNullContextThenNothingIsChanged);
+    RUN_TEST_CASE(menu_lib_ctx, GivenDefaultMenuViewInitWhenMenuCtxEscWithNullContextThenNothingIsChanged);
+    RUN_TEST_CASE(menu_lib_ctx, GivenDefaultMenuViewInitWhenMenuCtxMoveByWithNullContextThenNothingIsChanged);
+    RUN_TEST_CASE(menu_lib_ctx, GivenDefaultMenuViewInitWhenMenuCtxPageDownWithNullContextThenNothingIsChanged);
+    RUN_TEST_CASE(menu_lib_ctx, GivenDefaultMenuViewInitWhenMenuCtxPageUpWithNullContextThenNothingIsChanged);
+    RUN_TEST_CASE(menu_lib_ctx, GivenDefaultMenuViewInitWhenMenuCtxFirstWithNullContextThenNothingIsChanged);
+    RUN_TEST_CASE(menu_lib_ctx, GivenDefaultMenuViewInitWhenMenuCtxLastWithNullContextThenNothingIsChanged);
+    RUN_TEST_CASE(menu_lib_ctx, GivenDefaultMenuViewInitWhenMenuCtxUpdateScreenViewWithNullContextThenNothingIsChanged);
+    RUN_TEST_CASE(menu_lib_ctx, GivenDefaultMenuViewInitWhenMenuCtxSetRenderModeWithNullContextThenNothingIsChanged);
+    RUN_TEST_CASE(menu_lib_ctx, WhenMenuCtxGetCurrentMenuPositionWithNullContextThenReturnNoNode);
+}
+
+TEST_GROUP_RUNNER(menu_lib_row_write)
+{
+    /* Row write driver Test cases to run */
+    RUN_TEST_CASE(menu_lib_row_write, GivenMenuInitWithRowWriteDriverWhenMenuViewInitCalledThenScreenContentIsEqualToExpected);
+    RUN_TEST_CASE(menu_lib_row_write, GivenMenuInitWithRowWriteDriverWhenMenuViewInitCalledThenOneWriteRowCallPerRowAndNoOtherDriverCalls);
+    RUN_TEST_CASE(menu_lib_row_write, GivenMenuInitWithRowWriteDriverAndCustomHeaderWhenMenuViewInitCalledThenHeaderIsCentered);
+    RUN_TEST_CASE(menu_lib_row_write, GivenMenuInitWithRowWriteDriverAndMenuNextCalledWhenMenuEnterCalledThenScreenContentIsEqualToExpected);
+    RUN_TEST_CASE(menu_lib_row_write, GivenMenuInitWithRowWriteDriverAndMenuNextCalled4TimesWhenMenuPrevCalledOnceThenScreenContentIsEqualToExpected);
+    RUN_TEST_CASE(menu_lib_row_write, GivenMenuInitWithRowWriteDriverAndIncrementalRenderModeWhenMenuNextCalledWithoutScrollThenNoWriteRowCall);
+    /* Fill driver Test cases to run */
+    RUN_TEST_CASE(menu_lib_row_write, GivenMenuInitWithFillDriverWhenMenuViewInitCalledThenScreenContentIsEqualToExpected);
+    RUN_TEST_CASE(menu_lib_row_write, GivenMenuInitWithFillDriverWhenMenuViewInitCalledThenHeaderIsPrintedAsOneStringAndClearUsesOneFillCallPerRow);
+    /* Header row Test cases to run */
+    RUN_TEST_CASE(menu_lib_row_write, GivenMenuInitWithPerCharDriverAndMenuNextCalledWhenMenuEnterCalledThenSubMenuHeaderIsPrintedWithOnePrintStringCall);
+    RUN_TEST_CASE(menu_lib_row_write, GivenSubMenuEnteredAndLeftWhenOtherSubMenuEnteredThenHeaderShowsNewParentName);
+}
+
+TEST_GROUP_RUNNER(menu_lib_event_queue)
+{
+    /* Navigation event queue Test cases to run */
+    RUN_TEST_CASE(menu_lib_event_queue, GivenMenuViewInitWhenNextEventsPostedThenScreenAndMenuPositionAreNotChanged);
+    RUN_TEST_CASE(menu_lib_event_queue, GivenMenuViewInitAndEightNextEventsPostedWhenMenuProcessCalledThenViewIsRedrawnOnce);
+    RUN_TEST_CASE(menu_lib_event_queue, GivenMenuViewInitAndMixedEventsPostedWhenMenuProcessCalledThenScreenContentIsEqualToExpected);
+    RUN_TEST_CASE(menu_lib_event_queue, GivenMenuViewInitAndNoEventPostedWhenMenuProcessCalledThenNoDriverCall);
+    RUN_TEST_CASE(menu_lib_event_queue, GivenQueueFilledWithEventsWhenMenuPostEventCalledThenReturnEventQueueFull);
+    RUN_TEST_CASE(menu_lib_event_queue, GivenFullQueueProcessedWhenMenuPostEventCalledThenReturnOk);
+    RUN_TEST_CASE(menu_lib_event_queue, GivenEnterEventOnItemWithCallbackFollowedByNextEventWhenMenuProcessCalledThenCallbackIsExecutedAndNextEventIsDiscarded);
+    RUN_TEST_CASE(menu_lib_event_queue, GivenMenuViewInitWithExitCallbackAndEscEventPostedWhenMenuProcessCalledThenTopLevelExitCallbackIsExecuted);
+    RUN_TEST_CASE(menu_lib_event_queue, GivenIncrementalRenderModeAndSubmenuSwappedBySameLevelEventsWhenMenuProcessCalledThenNewSubmenuIsDrawn);
+    RUN_TEST_CASE(menu_lib_event_queue, WhenMenuCtxPostEventWithNullContextThenReturnNoContext);
+    RUN_TEST_CASE(menu_lib_event_queue, WhenMenuCtxProcessWithNullContextThenReturnNoContext);
+}
+
+TEST_GROUP_RUNNER(menu_lib_move)
+{
+    /* Multi-step and absolute navigation Test cases to run */
+    RUN_TEST_CASE(menu_lib_move, GivenMenuViewInitWhenMenuMoveBy3CalledThenScreenContentIsEqualToExpectedAndViewIsRedrawnOnce);
+    RUN_TEST_CASE(menu_lib_move, GivenMenuNextCalled4TimesWhenMenuMoveByMinus3CalledThenScreenContentIsEqualToExpected);
+    RUN_TEST_CASE(menu_lib_move, GivenMenuViewInitWhenMenuMoveByMoreThanItemsCalledThenLastItemIsSelected);
+    RUN_TEST_CASE(menu_lib_move, GivenMenuViewInitWhenMenuMoveBy0CalledThenNoDriverCall);
+    RUN_TEST_CASE(menu_lib_move, GivenMenuViewInitWhenMenuPageDownCalledThenCursorMovesByMenuRowsQty);
+    RUN_TEST_CASE(menu_lib_move, GivenMenuPageDownCalledWhenMenuPageUpCalledThenScreenContentIsEqualToExpected);
+    RUN_TEST_CASE(menu_lib_move, GivenMenuNextCalledWhenMenuEnterAndMenuLastCalledThenScreenContentIsEqualToExpected);
+    RUN_TEST_CASE(menu_lib_move, GivenMenuLastCalledWhenMenuFirstCalledThenScreenContentIsEqualToExpected);
+}
+
+TEST_GROUP_RUNNER(menu_lib_profiling)
+{
+    /* Bus cost profiling driver Test cases to run */
+    RUN_TEST_CASE(menu_lib_profiling, GivenProfilingDriverWrappingMockDriverWhenMenuCtxViewInitThenScreenIsDrawnAndEveryCallIsTraced);
+    RUN_TEST_CASE(menu_lib_profiling, GivenMenuCtxViewInitWhenMenuCtxNextThenBusTimeIsEqualToSumOfTracedCallCosts);
+    RUN_TEST_CASE(menu_lib_profiling, GivenHd44780BusyFlagModelAndRowWriteDriverWhenMenuCtxNextThenBusTimeStaysUnder4ms);
+    RUN_TEST_CASE(menu_lib_profiling, GivenPcf8574ModelWhenMenuCtxNextThenRowWriteDriverBusTimeIsLowerThanPerCharDriverBusTime);
+    RUN_TEST_CASE(menu_lib_profiling, GivenSameNavigationWhenPricedWithFixedDelayModelThenBusTimeIsHigherThanWithBusyFlagModel);
+    RUN_TEST_CASE(menu_lib_profiling, GivenFullTraceWhenNextCallsRecordedThenCallsAreCountedAsDroppedAndStillPriced);
+}
@@ -18,15 +18,17 @@ uint8_t mock_cur_lcd_x;
 uint8_t mock_cur_lcd_y;
 
 mock_menu_screen_init_status_e mock_menu_screen_init_status = MENU_SCREEN_INIT_UNKNOWN;
+uint16_t mock_cursor_position_call_counter = 0;
+uint16_t mock_print_string_call_counter = 0;
+uint16_t mock_print_char_call_counter = 0;
+uint16_t mock_write_row_call_counter = 0;
+uint16_t mock_fill_call_counter = 0;
 const struct menu_screen_driver_interface_struct *mock_driver_ptr = NULL;
 
 static void mock_screen_init(void);
 static uint8_t get_number_of_screen_lines(void);
 static uint8_t get_number_of_chars_per_line(void);
 static void mock_clr_scr(void);
-static void mock_cursor_position(uint8_t row, uint8_t column);
-static void mock_print_string(const char *str);
-static void mock_print_char(const char C);
 
 static void mock_copy_screen_char_table_2_scree_string_line_table(void);
 static void update_current_mock_lcd_cursor_position(void);
@@ -40,6 +42,33 @@ const struct menu_screen_driver_interface_struct mock_menu_screen_driver_interfa
     mock_cursor_position,
     mock_print_string,
     mock_print_char,
+    NULL,
+    NULL,
+    NULL,
+};
+const struct menu_screen_driver_interface_struct mock_menu_screen_row_driver_interface = {
+    mock_screen_init,
+    get_number_of_screen_lines,
+    get_number_of_chars_per_line,
+    mock_clr_scr,
+    mock_cursor_position,
+    mock_print_string,
+    mock_print_char,
+    mock_write_row,
+    mock_fill,
+    NULL,
+};
+const struct menu_screen_driver_interface_struct mock_menu_screen_fill_driver_interface = {
+    mock_screen_init,
+    get_number_of_screen_lines,
+    get_number_of_chars_per_line,
+    mock_clr_scr,
+    mock_cursor_position,
+    mock_print_string,
+    mock_print_char,
+    NULL,
+    mock_fill,
+    NULL,
 };
 
 const struct menu_screen_driver_interface_struct *get_menu_display_driver_interface(void)
@@ -70,16 +99,18 @@ static void mock_clr_scr(void)
     }
     mock_copy_screen_char_table_2_scree_string_line_table();
 }
-static void mock_cursor_position(uint8_t row, uint8_t column)
+void mock_cursor_position(uint8_t row, uint8_t column)
 {
     mock_cur_lcd_x = column;
     mock_cur_lcd_y = row;
+    mock_cursor_position_call_counter++;
 }
-static void mock_print_string(const char *str)
+void mock_print_string(const char *str)
 {
     char *lcd_cur_pos_ptr = &mock_lcd_screen[mock_cur_lcd_y][mock_cur_lcd_x];
     const char *char_ptr = str;
     uint8_t len = strlen(str);
+    mock_print_string_call_counter++;
     for (uint8_t i = 0; i < len; i++)
     {
 
@@ -94,12 +125,32 @@ static void mock_print_string(const char *str)
     }
     mock_copy_screen_char_table_2_scree_string_line_table();
 }
-static void mock_print_char(const char C)
+void mock_print_char(const char C)
 {
+    mock_print_char_call_counter++;
     mock_lcd_screen[mock_cur_lcd_y][mock_cur_lcd_x] = C;
     mock_copy_screen_char_table_2_scree_string_line_table();
     update_current_mock_lcd_cursor_position();
 }
+void mock_write_row(uint8_t row, const char *buf, uint8_t len)
+{
+    mock_write_row_call_counter++;
+    for (uint8_t i = 0; (i < len) && (i < LCD_X); i++)
+    {
+        mock_lcd_screen[row][i] = buf[i];
+    }
+    mock_copy_screen_char_table_2_scree_string_line_table();
+}
+
+void mock_fill(uint8_t row, uint8_t column, char character, uint8_t len)
+{
+    mock_fill_call_counter++;
+    for (uint8_t i = column; (i < (column + len)) && (i < LCD_X); i++)
+    {
+        mock_lcd_screen[row][i] = character;
+    }
+    mock_copy_screen_char_table_2_scree_string_line_table();
+}
 
 static void mock_copy_screen_char_table_2_scree_string_line_table(void)
 {
@@ -139,7 +190,26 @@ void deinit_mock_screen_driver(void)
     mock_driver_ptr = NULL;
 }
 
+void init_mock_row_screen_driver(void)
+{
+    mock_driver_ptr = &mock_menu_screen_row_driver_interface;
+}
+
+void init_mock_fill_screen_driver(void)
+{
+    mock_driver_ptr = &mock_menu_screen_fill_driver_interface;
+}
+
 void init_mock_incomplete_screen_driver(void)
 {
     mock_driver_ptr = &mock_menu_screen_incomplete_driver_interface;
+}
+
+void mock_reset_driver_call_counters(void)
+{
+    mock_cursor_position_call_counter = 0;
+    mock_print_string_call_counter = 0;
+    mock_print_char_call_counter = 0;
+    mock_write_row_call_counter = 0;
+    mock_fill_call_counter = 0;
 }
\ No newline at end of file
@@ -26,7 +26,22 @@ extern char *mock_screen_lines[LCD_Y];
 extern uint8_t mock_cur_lcd_x;
 extern uint8_t mock_cur_lcd_y;
 extern mock_menu_screen_init_status_e mock_menu_screen_init_status;
+extern uint16_t mock_cursor_position_call_counter;
+extern uint16_t mock_print_string_call_counter;
+extern uint16_t mock_print_char_call_counter;
+extern uint16_t mock_write_row_call_counter;
+extern uint16_t mock_fill_call_counter;
 
 void init_mock_screen_driver(void);
 void deinit_mock_screen_driver(void);
-void init_mock_incomplete_screen_driver(void);
\ No newline at end of file
+void init_mock_row_screen_driver(void);
+void init_mock_fill_screen_driver(void);
+void init_mock_incomplete_screen_driver(void);
+void mock_reset_driver_call_counters(void);
+
+/* Driver functions, also bound directly by static_driver/menu_static_driver.h */
+void mock_cursor_position(uint8_t row, uint8_t column);
+void mock_print_string(const char *str);
+void mock_print_char(const char C);
+void mock_write_row(uint8_t row, const char *buf, uint8_t len);
+void mock_fill(uint8_t row, uint8_t column, char character, uint8_t len);
@@ -0,0 +1,185 @@
+/**
+ * @file profiling_screen_driver.c
+ * @author niwciu (niwciu@gmail.com)
+ * @brief Tracing screen driver with bus cost estimation.
+ * @date 2025-11-27
+ *
+ * Calls beyond PROFILING_TRACE_SIZE are not stored in the trace, but they are
+ * still forwarded and priced, so the bus time stays exact for long scripts.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include "profiling_screen_driver.h"
+#include <stddef.h>
+#include <string.h>
+
+/* 2 nibble strobes + busy flag read in 4-bit mode on top of 37 us execution, clear takes 1.52 ms */
+const profiling_cost_model_t profiling_hd44780_busy_flag_model = {"hd44780_busy_flag", 0U, 43000U, 43000U, 1560000U};
+/* every byte waits the fixed 120 us, lcd_cls waits additional 4.9 ms */
+const profiling_cost_model_t profiling_hd44780_fixed_delay_model = {"hd44780_fixed_delay", 0U, 122000U, 122000U, 5022000U};
+/* start + address byte per transaction, 4 expander bytes (2 nibbles x E strobe) per LCD byte, 9 bits per I2C byte */
+const profiling_cost_model_t profiling_pcf8574_i2c_model = {"pcf8574_i2c_100khz", 100000U, 360000U, 360000U, 1880000U};
+/* 10 bits per byte, "ESC[rr;ccH" for cursor moves, "ESC[2J" for clear */
+const profiling_cost_model_t profiling_vt100_uart_model = {"vt100_uart_115200", 0U, 694444U, 86806U, 347222U};
+
+profiling_trace_entry_t profiling_trace[PROFILING_TRACE_SIZE];
+uint16_t profiling_trace_len;
+uint32_t profiling_trace_dropped;
+
+static const struct menu_screen_driver_interface_struct *inner_driver;
+static const profiling_cost_model_t *cost_model;
+static struct menu_screen_driver_interface_struct profiling_driver_interface;
+static uint64_t bus_time_ns;
+static uint8_t profiling_cur_row;
+static uint8_t profiling_cur_column;
+
+static void profiling_screen_init(void);
+static uint8_t profiling_get_number_of_screen_lines(void);
+static uint8_t profiling_get_number_of_chars_per_line(void);
+static void profiling_clr_scr(void);
+static void profiling_cursor_position(uint8_t row, uint8_t column);
+static void profiling_print_string(const char *str);
+static void profiling_print_char(const char C);
+static void profiling_write_row(uint8_t row, const char *buf, uint8_t len);
+static void profiling_fill(uint8_t row, uint8_t column, char character, uint8_t len);
+static void record_call(profiling_op_e op, uint8_t len, char character, uint32_t cost_ns);
+
+const struct menu_screen_driver_interface_struct *profiling_driver_init(const struct menu_screen_driver_interface_struct *inner,
+                                                                         const profiling_cost_model_t *model)
+{
+    inner_driver = inner;
+    cost_model = model;
+
+    profiling_driver_interface.screen_init = profiling_screen_init;
+    profiling_driver_interface.get_number_of_screen_lines = profiling_get_number_of_screen_lines;
+    profiling_driver_interface.get_number_of_chars_per_line = profiling_get_number_of_chars_per_line;
+    profiling_driver_interface.clr_scr = profiling_clr_scr;
+    profiling_driver_interface.cursor_position = profiling_cursor_position;
+    profiling_driver_interface.print_string = profiling_print_string;
+    profiling_driver_interface.print_char = profiling_print_char;
+    profiling_driver_interface.write_row = (inner->write_row != NULL) ? profiling_write_row : NULL;
+    profiling_driver_interface.fill = (inner->fill != NULL) ? profiling_fill : NULL;
+
+    profiling_reset_trace();
+
+    return &profiling_driver_interface;
+}
+
+void profiling_reset_trace(void)
+{
+    profiling_trace_len = 0U;
+    profiling_trace_dropped = 0U;
+    bus_time_ns = 0U;
+}
+
+uint64_t profiling_get_bus_time_ns(void)
+{
+    return bus_time_ns;
+}
+
+uint32_t profiling_get_bus_time_us(void)
+{
+    return (uint32_t)(bus_time_ns / 1000U);
+}
+
+uint16_t profiling_count_ops(profiling_op_e op)
+{
+    uint16_t ops = 0U;
+
+    for (uint16_t i = 0U; i < profiling_trace_len; i++)
+    {
+        if (profiling_trace[i].op == op)
+        {
+            ops++;
+        }
+    }
+
+    return ops;
+}
+
+static void profiling_screen_init(void)
+{
+    inner_driver->screen_init();
+}
+
+static uint8_t profiling_get_number_of_screen_lines(void)
+{
+    return inner_driver->get_number_of_screen_lines();
+}
+
+static uint8_t profiling_get_number_of_chars_per_line(void)
+{
+    return inner_driver->get_number_of_chars_per_line();
+}
+
+static void profiling_clr_scr(void)
+{
+    profiling_cur_row = 0U;
+    profiling_cur_column = 0U;
+    record_call(PROFILING_OP_CLR_SCR, 0U, ' ', cost_model->call_ns + cost_model->clr_scr_ns);
+    inner_driver->clr_scr();
+}
+
+static void profiling_cursor_position(uint8_t row, uint8_t column)
+{
+    profiling_cur_row = row;
+    profiling_cur_column = column;
+    record_call(PROFILING_OP_CURSOR_POSITION, 0U, '\0', cost_model->call_ns + cost_model->cursor_ns);
+    inner_driver->cursor_position(row, column);
+}
+
+static void profiling_print_string(const char *str)
+{
+    uint8_t len = (uint8_t)strlen(str);
+
+    record_call(PROFILING_OP_PRINT_STRING, len, str[0], cost_model->call_ns + (len * cost_model->char_ns));
+    profiling_cur_column += len;
+    inner_driver->print_string(str);
+}
+
+static void profiling_print_char(const char C)
+{
+    record_call(PROFILING_OP_PRINT_CHAR, 1U, C, cost_model->call_ns + cost_model->char_ns);
+    profiling_cur_column++;
+    inner_driver->print_char(C);
+}
+
+static void profiling_write_row(uint8_t row, const char *buf, uint8_t len)
+{
+    profiling_cur_row = row;
+    profiling_cur_column = 0U;
+    record_call(PROFILING_OP_WRITE_ROW, len, buf[0], cost_model->call_ns + cost_model->cursor_ns + (len * cost_model->char_ns));
+    profiling_cur_column = len;
+    inner_driver->write_row(row, buf, len);
+}
+
+static void profiling_fill(uint8_t row, uint8_t column, char character, uint8_t len)
+{
+    profiling_cur_row = row;
+    profiling_cur_column = column;
+    record_call(PROFILING_OP_FILL, len, character, cost_model->call_ns + cost_model->cursor_ns + (len * cost_model->char_ns));
+    profiling_cur_column += len;
+    inner_driver->fill(row, column, character, len);
+}
+
+static void record_call(profiling_op_e op, uint8_t len, char character, uint32_t cost_ns)
+{
+    bus_time_ns += cost_ns;
+    if (profiling_trace_len < PROFILING_TRACE_SIZE)
+    {
+        profiling_trace_entry_t *entry = &profiling_trace[profiling_trace_len];
+
+        entry->op = op;
+        entry->row = profiling_cur_row;
+        entry->column = profiling_cur_column;
+        entry->len = len;
+        entry->character = character;
+        entry->cost_ns = cost_ns;
+        profiling_trace_len++;
+    }
+    else
+    {
+        profiling_trace_dropped++;
+    }
+}
@@ -0,0 +1,77 @@
+/**
+ * @file profiling_screen_driver.h
+ * @author niwciu (niwciu@gmail.com)
+ * @brief Tracing screen driver with bus cost estimation.
+ * @date 2025-11-27
+ *
+ * The profiling driver wraps any menu screen driver, forwards every call to it
+ * and records the call in a trace. Each call is priced with a per-operation
+ * cost model, so tests and benchmarks can check the estimated time a
+ * navigation step keeps the display bus busy.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#pragma once
+
+#include "menu_screen_driver_interface.h"
+#include <stdint.h>
+
+#define PROFILING_TRACE_SIZE 256U
+
+typedef enum
+{
+    PROFILING_OP_CLR_SCR,
+    PROFILING_OP_CURSOR_POSITION,
+    PROFILING_OP_PRINT_STRING,
+    PROFILING_OP_PRINT_CHAR,
+    PROFILING_OP_WRITE_ROW,
+    PROFILING_OP_FILL,
+} profiling_op_e;
+
+/**
+ * @brief Estimated bus cost of the driver primitives in nanoseconds.
+ *
+ * A driver call costs call_ns plus the cost of what it sends: cursor_ns for
+ * a cursor move (write_row and fill move the cursor too), char_ns for every
+ * character and clr_scr_ns for clearing the screen.
+ */
+typedef struct
+{
+    const char *name;
+    uint32_t call_ns;
+    uint32_t cursor_ns;
+    uint32_t char_ns;
+    uint32_t clr_scr_ns;
+} profiling_cost_model_t;
+
+typedef struct
+{
+    profiling_op_e op;
+    uint8_t row;
+    uint8_t column;
+    uint8_t len;
+    char character;
+    uint32_t cost_ns;
+} profiling_trace_entry_t;
+
+/** @brief HD44780 in 4-bit mode polling the busy flag (37 us execution time per byte). */
+extern const profiling_cost_model_t profiling_hd44780_busy_flag_model;
+/** @brief HD44780 in 4-bit mode with fixed 120 us delay after every byte (lcd_write_byte). */
+extern const profiling_cost_model_t profiling_hd44780_fixed_delay_model;
+/** @brief HD44780 behind PCF8574 I2C backpack at 100 kHz, one I2C transaction per driver call. */
+extern const profiling_cost_model_t profiling_pcf8574_i2c_model;
+/** @brief VT100 terminal on UART 115200 baud 8N1. */
+extern const profiling_cost_model_t profiling_vt100_uart_model;
+
+extern profiling_trace_entry_t profiling_trace[PROFILING_TRACE_SIZE];
+extern uint16_t profiling_trace_len;
+extern uint32_t profiling_trace_dropped;
+
+const struct menu_screen_driver_interface_struct *profiling_driver_init(const struct menu_screen_driver_interface_struct *inner,
+                                                                         const profiling_cost_model_t *model);
+void profiling_reset_trace(void);
+uint64_t profiling_get_bus_time_ns(void);
+uint32_t profiling_get_bus_time_us(void);
+uint16_t profiling_count_ops(profiling_op_e op);
@@ -0,0 +1,182 @@
+#include "unity/fixture/unity_fixture.h"
+#include "menu_lib.h"
+#include "mock_menu_implementation.h"
+#include "mock_menu_screen_driver_interface.h"
+#include <stddef.h>
+#include <string.h>
+
+static void clear_mock_lcd_screen(void);
+
+TEST_GROUP(menu_lib_shadow_buffer);
+
+TEST_SETUP(menu_lib_shadow_buffer)
+{
+    /* Init before every test */
+    init_mock_screen_driver();
+    clear_mock_lcd_screen();
+}
+
+TEST_TEAR_DOWN(menu_lib_shadow_buffer)
+{
+    /* Cleanup after every test */
+    menu_set_render_mode(MENU_RENDER_FULL);
+    init_mock_screen_driver();
+}
+
+TEST(menu_lib_shadow_buffer, WhenMenuViewInitCalledThenScreenContentIsEqualToExpectedAndEachRowIsWrittenWithOneSpan)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        ">menu_1             ",
+        " menu_2             ",
+        " menu_3             "};
+    // Given
+    menu_init();
+    mock_reset_driver_call_counters();
+    // When
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+    TEST_ASSERT_EQUAL(LCD_Y, mock_cursor_position_call_counter);
+    TEST_ASSERT_EQUAL(LCD_Y, mock_print_string_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_print_char_call_counter);
+}
+
+TEST(menu_lib_shadow_buffer, GivenMenuViewInitWhenMenuNextCalledWithoutScrollThenOnlyCursorMarkerSpansAreWritten)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        " menu_1             ",
+        ">menu_2             ",
+        " menu_3             "};
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    mock_reset_driver_call_counters();
+    // When
+    menu_next();
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+    TEST_ASSERT_EQUAL(2, mock_cursor_position_call_counter);
+    TEST_ASSERT_EQUAL(2, mock_print_string_call_counter);
+}
+
+TEST(menu_lib_shadow_buffer, GivenMenuViewInitWhenMenuNextCalled3TimesThenScreenContentIsEqualToExpected)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        " menu_2             ",
+        " menu_3             ",
+        ">menu_4             "};
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    // When
+    menu_next();
+    menu_next();
+    menu_next();
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_shadow_buffer, GivenMenuViewInitAndMenuNextCalled2TimesWhenMenuNextCalledWithScrollThenOnlyChangedCharactersAreWritten)
+{
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    menu_next();
+    menu_next();
+    mock_reset_driver_call_counters();
+    // When
+    menu_next();
+    // Then
+    /* rows 1..3: only the last digit of the name changes, cursor marker stays in row 3 */
+    TEST_ASSERT_EQUAL(3, mock_print_string_call_counter);
+    TEST_ASSERT_EQUAL(3, mock_cursor_position_call_counter);
+}
+
+TEST(menu_lib_shadow_buffer, GivenMenuNextCalledWhenMenuEnterAndMenuEscCalledThenScreenContentIsEqualToExpected)
+{
+    const char *expected_sub_menu_screen[4] = {
+        "------ menu_2 ------",
+        ">menu_2_1           ",
+        " menu_2_2           ",
+        " menu_2_3           "};
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        " menu_1             ",
+        ">menu_2             ",
+        " menu_3             "};
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    menu_next();
+    // When
+    menu_enter();
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_sub_menu_screen, mock_screen_lines, LCD_Y);
+    menu_esc();
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_shadow_buffer, GivenScreenOverwrittenByApplicationWhenUpdateScreenViewCalledThenWholeViewIsRestored)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        " menu_1             ",
+        ">menu_2             ",
+        " menu_3             "};
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    menu_next();
+    clear_mock_lcd_screen();
+    // When
+    update_screen_view();
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_shadow_buffer, GivenIncrementalRenderModeWhenMenuNextCalledTwiceThenScreenContentIsEqualToExpected)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        " menu_1             ",
+        " menu_2             ",
+        ">menu_3             "};
+    // Given
+    menu_init();
+    menu_set_render_mode(MENU_RENDER_INCREMENTAL);
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    // When
+    menu_next();
+    menu_next();
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_shadow_buffer, GivenRowWriteDriverWhenMenuNextCalledWithoutScrollThenOnlyChangedRowsAreWritten)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        " menu_1             ",
+        ">menu_2             ",
+        " menu_3             "};
+    // Given
+    init_mock_row_screen_driver();
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    mock_reset_driver_call_counters();
+    // When
+    menu_next();
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+    TEST_ASSERT_EQUAL(2, mock_write_row_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_print_string_call_counter);
+}
+
+static void clear_mock_lcd_screen(void)
+{
+    const struct menu_screen_driver_interface_struct *driver = get_menu_display_driver_interface();
+    driver->clr_scr();
+}
@@ -0,0 +1,14 @@
+#include "unity/fixture/unity_fixture.h"
+
+TEST_GROUP_RUNNER(menu_lib_shadow_buffer)
+{
+    /* Shadow buffer Test cases to run */
+    RUN_TEST_CASE(menu_lib_shadow_buffer, WhenMenuViewInitCalledThenScreenContentIsEqualToExpectedAndEachRowIsWrittenWithOneSpan);
+    RUN_TEST_CASE(menu_lib_shadow_buffer, GivenMenuViewInitWhenMenuNextCalledWithoutScrollThenOnlyCursorMarkerSpansAreWritten);
+    RUN_TEST_CASE(menu_lib_shadow_buffer, GivenMenuViewInitWhenMenuNextCalled3TimesThenScreenContentIsEqualToExpected);
+    RUN_TEST_CASE(menu_lib_shadow_buffer, GivenMenuViewInitAndMenuNextCalled2TimesWhenMenuNextCalledWithScrollThenOnlyChangedCharactersAreWritten);
+    RUN_TEST_CASE(menu_lib_shadow_buffer, GivenMenuNextCalledWhenMenuEnterAndMenuEscCalledThenScreenContentIsEqualToExpected);
+    RUN_TEST_CASE(menu_lib_shadow_buffer, GivenScreenOverwrittenByApplicationWhenUpdateScreenViewCalledThenWholeViewIsRestored);
+    RUN_TEST_CASE(menu_lib_shadow_buffer, GivenIncrementalRenderModeWhenMenuNextCalledTwiceThenScreenContentIsEqualToExpected);
+    RUN_TEST_CASE(menu_lib_shadow_buffer, GivenRowWriteDriverWhenMenuNextCalledWithoutScrollThenOnlyChangedRowsAreWritten);
+}
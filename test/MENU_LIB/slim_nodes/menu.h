@@ -0,0 +1,35 @@
+/**
+ * @file menu.h
+ * @author niwciu (niwciu@gmail.com)
+ * @brief Menu configuration for the slim node unit tests.
+ * @version 1.0.0
+ * @date 2025-12-16
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#ifndef MENU_USE_SLIM_NODES
+#define MENU_USE_SLIM_NODES
+#endif
+
+#include "menu_lib_type.h"
+
+#define MAX_MENU_DEPTH 4
+
+extern const menu_t slim_menu_settings;
+extern const menu_t slim_menu_network;
+extern const menu_t slim_menu_display;
+extern const menu_t slim_menu_info;
+extern const menu_t slim_menu_tools;
+extern const menu_t slim_menu_about;
+extern const menu_t slim_sub_menu_contrast;
+extern const menu_t slim_sub_menu_backlight;
+extern const menu_t slim_sub_menu_level;
+extern const menu_t slim_sub_menu_level_low;
+extern const menu_t slim_sub_menu_level_high;
+extern const menu_t slim_shared_menu_enable;
+extern const menu_t slim_shared_menu_disable;
+extern const menu_t slim_cyclic_menu_1;
+extern const menu_t slim_cyclic_menu_2;
@@ -0,0 +1,147 @@
+#include "unity/fixture/unity_fixture.h"
+#include "menu_lib.h"
+#include "mock_menu_screen_driver_interface.h"
+#include <stddef.h>
+
+static menu_ctx_t slim_ctx;
+
+TEST_GROUP(menu_lib_slim_nodes);
+
+TEST_SETUP(menu_lib_slim_nodes)
+{
+    /* Init before every test */
+    init_mock_screen_driver();
+    menu_ctx_init(&slim_ctx, get_menu_display_driver_interface());
+}
+
+TEST_TEAR_DOWN(menu_lib_slim_nodes)
+{
+    /* Cleanup after every test */
+}
+
+TEST(menu_lib_slim_nodes, WhenMenuCtxViewInitThenTopLevelItemsAreDisplayed)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        ">Settings           ",
+        " Network            ",
+        " Display            "};
+    // When
+    menu_status_t status = menu_ctx_view_init(&slim_ctx, &slim_menu_settings, NULL, NULL);
+    // Then
+    TEST_ASSERT_EQUAL(MENU_OK, status);
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_slim_nodes, GivenSelectionMovedPastScreenWhenMenuCtxPrevCalledBackToFirstItemThenInitialViewIsDisplayed)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        ">Settings           ",
+        " Network            ",
+        " Display            "};
+    // Given
+    menu_ctx_view_init(&slim_ctx, &slim_menu_settings, NULL, NULL);
+    for (uint8_t i = 0U; i < 5U; i++)
+    {
+        menu_ctx_next(&slim_ctx);
+    }
+    // When
+    for (uint8_t i = 0U; i < 5U; i++)
+    {
+        menu_ctx_prev(&slim_ctx);
+    }
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+    TEST_ASSERT_EQUAL_PTR(&slim_menu_settings, slim_ctx.current_menu_pointer);
+    TEST_ASSERT_EQUAL(0, slim_ctx.cursor_selection_menu_index[0]);
+}
+
+TEST(menu_lib_slim_nodes, GivenMenuCtxViewInitWhenMenuCtxEnterCalledThenSubmenuHeaderIsParentName)
+{
+    const char *expected_screen[4] = {
+        "----- Settings -----",
+        ">Contrast           ",
+        " Backlight          ",
+        "                    "};
+    // Given
+    menu_ctx_view_init(&slim_ctx, &slim_menu_settings, NULL, NULL);
+    // When
+    menu_ctx_enter(&slim_ctx);
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_slim_nodes, GivenThirdMenuLevelSelectedWhenMenuCtxEscCalledTwiceThenTopLevelItemIsSelected)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        ">Settings           ",
+        " Network            ",
+        " Display            "};
+    // Given
+    menu_ctx_view_init(&slim_ctx, &slim_menu_settings, NULL, NULL);
+    menu_ctx_enter(&slim_ctx);
+    menu_ctx_enter(&slim_ctx);
+    menu_ctx_next(&slim_ctx);
+    TEST_ASSERT_EQUAL_PTR(&slim_sub_menu_level, slim_ctx.current_menu_pointer);
+    // When
+    menu_ctx_esc(&slim_ctx);
+    menu_ctx_esc(&slim_ctx);
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+    TEST_ASSERT_EQUAL_PTR(&slim_menu_settings, slim_ctx.current_menu_pointer);
+    TEST_ASSERT_EQUAL(0, slim_ctx.menu_level);
+}
+
+TEST(menu_lib_slim_nodes, GivenSharedSubmenuEnteredFromDisplayWhenMenuCtxEscCalledThenDisplayIsSelected)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        " Settings           ",
+        " Network            ",
+        ">Display            "};
+    // Given
+    menu_ctx_view_init(&slim_ctx, &slim_menu_settings, NULL, NULL);
+    menu_ctx_next(&slim_ctx);
+    menu_ctx_next(&slim_ctx);
+    menu_ctx_enter(&slim_ctx);
+    menu_ctx_next(&slim_ctx);
+    // When
+    menu_ctx_esc(&slim_ctx);
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+    TEST_ASSERT_EQUAL_PTR(&slim_menu_display, slim_ctx.current_menu_pointer);
+}
+
+TEST(menu_lib_slim_nodes, GivenLastItemSelectedWhenMenuCtxMoveByNegativeDeltaThenItemAboveIsSelected)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        ">Network            ",
+        " Display            ",
+        " Info               "};
+    // Given
+    menu_ctx_view_init(&slim_ctx, &slim_menu_settings, NULL, NULL);
+    menu_ctx_last(&slim_ctx);
+    // When
+    menu_ctx_move_by(&slim_ctx, -4);
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+    TEST_ASSERT_EQUAL_PTR(&slim_menu_network, slim_ctx.current_menu_pointer);
+    TEST_ASSERT_EQUAL(1, slim_ctx.cursor_selection_menu_index[0]);
+}
+
+TEST(menu_lib_slim_nodes, GivenCyclicNextLinksWhenMenuCtxViewInitThenMalformedMenuIsReturned)
+{
+    // When
+    menu_status_t status = menu_ctx_view_init(&slim_ctx, &slim_cyclic_menu_1, NULL, NULL);
+    // Then
+    TEST_ASSERT_EQUAL(MENU_ERR_MALFORMED_MENU, status);
+}
+
+TEST(menu_lib_slim_nodes, WhenSlimNodesUsedThenMenuItemHoldsFourFields)
+{
+    // Then
+    TEST_ASSERT_EQUAL(4U * sizeof(void *), sizeof(menu_t));
+}
@@ -0,0 +1,14 @@
+#include "unity/fixture/unity_fixture.h"
+
+TEST_GROUP_RUNNER(menu_lib_slim_nodes)
+{
+    /* Slim nodes without prev and parent links Test cases to run */
+    RUN_TEST_CASE(menu_lib_slim_nodes, WhenMenuCtxViewInitThenTopLevelItemsAreDisplayed);
+    RUN_TEST_CASE(menu_lib_slim_nodes, GivenSelectionMovedPastScreenWhenMenuCtxPrevCalledBackToFirstItemThenInitialViewIsDisplayed);
+    RUN_TEST_CASE(menu_lib_slim_nodes, GivenMenuCtxViewInitWhenMenuCtxEnterCalledThenSubmenuHeaderIsParentName);
+    RUN_TEST_CASE(menu_lib_slim_nodes, GivenThirdMenuLevelSelectedWhenMenuCtxEscCalledTwiceThenTopLevelItemIsSelected);
+    RUN_TEST_CASE(menu_lib_slim_nodes, GivenSharedSubmenuEnteredFromDisplayWhenMenuCtxEscCalledThenDisplayIsSelected);
+    RUN_TEST_CASE(menu_lib_slim_nodes, GivenLastItemSelectedWhenMenuCtxMoveByNegativeDeltaThenItemAboveIsSelected);
+    RUN_TEST_CASE(menu_lib_slim_nodes, GivenCyclicNextLinksWhenMenuCtxViewInitThenMalformedMenuIsReturned);
+    RUN_TEST_CASE(menu_lib_slim_nodes, WhenSlimNodesUsedThenMenuItemHoldsFourFields);
+}
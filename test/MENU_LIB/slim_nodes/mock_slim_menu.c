@@ -0,0 +1,34 @@
+/**
+ * @file mock_slim_menu.c
+ * @author niwciu (niwciu@gmail.com)
+ * @brief Menu built from slim nodes, without prev and parent links.
+ * @date 2025-12-16
+ *
+ * Network and Display open the same submenu, the parent of an item is known
+ * only from the navigation path. slim_cyclic_menu_1 and slim_cyclic_menu_2
+ * point at each other with their next links.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include "menu.h"
+#include <stddef.h>
+
+const menu_t slim_menu_settings = {"Settings", &slim_menu_network, &slim_sub_menu_contrast, NULL};
+const menu_t slim_menu_network = {"Network", &slim_menu_display, &slim_shared_menu_enable, NULL};
+const menu_t slim_menu_display = {"Display", &slim_menu_info, &slim_shared_menu_enable, NULL};
+const menu_t slim_menu_info = {"Info", &slim_menu_tools, NULL, NULL};
+const menu_t slim_menu_tools = {"Tools", &slim_menu_about, NULL, NULL};
+const menu_t slim_menu_about = {"About", NULL, NULL, NULL};
+
+const menu_t slim_sub_menu_contrast = {"Contrast", &slim_sub_menu_backlight, &slim_sub_menu_level, NULL};
+const menu_t slim_sub_menu_backlight = {"Backlight", NULL, NULL, NULL};
+const menu_t slim_sub_menu_level = {"Level", NULL, &slim_sub_menu_level_low, NULL};
+const menu_t slim_sub_menu_level_low = {"Low", &slim_sub_menu_level_high, NULL, NULL};
+const menu_t slim_sub_menu_level_high = {"High", NULL, NULL, NULL};
+
+const menu_t slim_shared_menu_enable = {"Enable", &slim_shared_menu_disable, NULL, NULL};
+const menu_t slim_shared_menu_disable = {"Disable", NULL, NULL, NULL};
+
+const menu_t slim_cyclic_menu_1 = {"Loop 1", &slim_cyclic_menu_2, NULL, NULL};
+const menu_t slim_cyclic_menu_2 = {"Loop 2", &slim_cyclic_menu_1, NULL, NULL};
@@ -0,0 +1,170 @@
+#include "unity/fixture/unity_fixture.h"
+#include "menu_lib.h"
+#include "mock_menu_implementation.h"
+#include "mock_menu_screen_driver_interface.h"
+#include <stddef.h>
+
+static menu_ctx_t static_driver_ctx;
+static uint16_t stub_draw_calls;
+
+static uint8_t stub_get_number_of_screen_lines(void);
+static uint8_t stub_get_number_of_chars_per_line(void);
+static void stub_screen_init(void);
+static void stub_cursor_position(uint8_t row, uint8_t column);
+static void stub_print_string(const char *str);
+static void stub_print_char(const char C);
+
+static const struct menu_screen_driver_interface_struct stub_draw_driver_interface = {
+    stub_screen_init,
+    stub_get_number_of_screen_lines,
+    stub_get_number_of_chars_per_line,
+    NULL,
+    stub_cursor_position,
+    stub_print_string,
+    stub_print_char,
+    NULL,
+    NULL,
+    NULL,
+};
+
+static const struct menu_screen_driver_interface_struct no_draw_driver_interface = {
+    stub_screen_init,
+    stub_get_number_of_screen_lines,
+    stub_get_number_of_chars_per_line,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+};
+
+TEST_GROUP(menu_lib_static_driver);
+
+TEST_SETUP(menu_lib_static_driver)
+{
+    /* Init before every test */
+    init_mock_screen_driver();
+    menu_init();
+    mock_reset_driver_call_counters();
+}
+
+TEST_TEAR_DOWN(menu_lib_static_driver)
+{
+    /* Cleanup after every test */
+}
+
+TEST(menu_lib_static_driver, WhenMenuViewInitThenScreenContentIsEqualToExpected)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        ">menu_1             ",
+        " menu_2             ",
+        " menu_3             "};
+    // When
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_static_driver, GivenMenuViewInitWhenMenuNextCalled5TimesThenScreenContentIsEqualToExpected)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        " menu_3             ",
+        " menu_4             ",
+        ">menu_5             "};
+    // Given
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    // When
+    for (uint8_t i = 0U; i < 5U; i++)
+    {
+        menu_next();
+    }
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_static_driver, GivenMenuViewInitWhenMenuEnterCalledThenSubmenuIsDrawnAndHeaderIsFilledWithBoundFill)
+{
+    const char *expected_screen[4] = {
+        "------ menu_1 ------",
+        ">menu_1_1           ",
+        " menu_1_2           ",
+        " menu_1_3           "};
+    // Given
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    mock_reset_driver_call_counters();
+    // When
+    menu_enter();
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+    TEST_ASSERT_TRUE(mock_fill_call_counter > 0U);
+    TEST_ASSERT_EQUAL(0, mock_write_row_call_counter);
+}
+
+TEST(menu_lib_static_driver, GivenDriverInterfaceWithStubDrawFunctionsWhenMenuCtxViewInitThenScreenIsDrawnOnlyThroughStaticBinding)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        ">menu_1             ",
+        " menu_2             ",
+        " menu_3             "};
+    // Given
+    stub_draw_calls = 0U;
+    menu_ctx_init(&static_driver_ctx, &stub_draw_driver_interface);
+    // When
+    menu_ctx_view_init(&static_driver_ctx, &mock_menu_1, NULL, NULL);
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+    TEST_ASSERT_EQUAL(0, stub_draw_calls);
+}
+
+TEST(menu_lib_static_driver, GivenDriverInterfaceWithoutDrawFunctionsWhenMenuCtxInitThenReturnOkAndScreenIsDrawnThroughStaticBinding)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        ">menu_1             ",
+        " menu_2             ",
+        " menu_3             "};
+    // When
+    menu_status_t status = menu_ctx_init(&static_driver_ctx, &no_draw_driver_interface);
+    menu_ctx_view_init(&static_driver_ctx, &mock_menu_1, NULL, NULL);
+    // Then
+    TEST_ASSERT_EQUAL(MENU_OK, status);
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+static uint8_t stub_get_number_of_screen_lines(void)
+{
+    return LCD_Y;
+}
+
+static uint8_t stub_get_number_of_chars_per_line(void)
+{
+    return LCD_X;
+}
+
+static void stub_screen_init(void)
+{
+}
+
+static void stub_cursor_position(uint8_t row, uint8_t column)
+{
+    (void)row;
+    (void)column;
+    stub_draw_calls++;
+}
+
+static void stub_print_string(const char *str)
+{
+    (void)str;
+    stub_draw_calls++;
+}
+
+static void stub_print_char(const char C)
+{
+    (void)C;
+    stub_draw_calls++;
+}
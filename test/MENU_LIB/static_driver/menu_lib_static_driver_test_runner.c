@@ -0,0 +1,11 @@
+#include "unity/fixture/unity_fixture.h"
+
+TEST_GROUP_RUNNER(menu_lib_static_driver)
+{
+    /* Static driver binding Test cases to run */
+    RUN_TEST_CASE(menu_lib_static_driver, WhenMenuViewInitThenScreenContentIsEqualToExpected);
+    RUN_TEST_CASE(menu_lib_static_driver, GivenMenuViewInitWhenMenuNextCalled5TimesThenScreenContentIsEqualToExpected);
+    RUN_TEST_CASE(menu_lib_static_driver, GivenMenuViewInitWhenMenuEnterCalledThenSubmenuIsDrawnAndHeaderIsFilledWithBoundFill);
+    RUN_TEST_CASE(menu_lib_static_driver, GivenDriverInterfaceWithStubDrawFunctionsWhenMenuCtxViewInitThenScreenIsDrawnOnlyThroughStaticBinding);
+    RUN_TEST_CASE(menu_lib_static_driver, GivenDriverInterfaceWithoutDrawFunctionsWhenMenuCtxInitThenReturnOkAndScreenIsDrawnThroughStaticBinding);
+}
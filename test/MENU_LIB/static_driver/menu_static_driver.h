@@ -0,0 +1,20 @@
+/**
+ * @file menu_static_driver.h
+ * @author niwciu (niwciu@gmail.com)
+ * @brief Compile-time display driver binding for the static driver unit tests.
+ * @date 2025-12-10
+ *
+ * Binds the engine drawing calls directly to the mock driver functions.
+ * write_row is not bound, so rows are drawn per character; fill is bound.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include "mock_menu_screen_driver_interface.h"
+
+#define MENU_STATIC_DRV_CURSOR_POSITION(row, column) mock_cursor_position((row), (column))
+#define MENU_STATIC_DRV_PRINT_STRING(str) mock_print_string(str)
+#define MENU_STATIC_DRV_PRINT_CHAR(c) mock_print_char(c)
+#define MENU_STATIC_DRV_FILL(row, column, c, len) mock_fill((row), (column), (c), (len))
@@ -0,0 +1,179 @@
+#include "unity/fixture/unity_fixture.h"
+#include "menu_lib.h"
+#include "mock_menu_implementation.h"
+#include "mock_menu_screen_driver_interface.h"
+#include <stddef.h>
+#include <string.h>
+
+#define DUMP_BUFFER_SIZE 64U
+
+static menu_trace_record_t trace_records[MENU_TRACE_BUFFER_SIZE];
+static uint32_t mock_tick;
+static uint8_t dump_buffer[DUMP_BUFFER_SIZE];
+static uint16_t dump_len;
+
+static uint32_t mock_get_tick(void);
+static void mock_dump_write(const uint8_t *data, uint16_t len);
+static uint16_t count_trace_records(uint16_t records_qty, uint8_t event);
+
+TEST_GROUP(menu_lib_trace);
+
+TEST_SETUP(menu_lib_trace)
+{
+    /* Init before every test */
+    init_mock_screen_driver();
+    menu_trace_set_tick_source(NULL);
+    menu_trace_clear();
+    mock_tick = 0U;
+    dump_len = 0U;
+}
+
+TEST_TEAR_DOWN(menu_lib_trace)
+{
+    /* Cleanup after every test */
+    menu_trace_set_tick_source(NULL);
+}
+
+TEST(menu_lib_trace, GivenMenuViewInitWhenMenuNextCalledThenNextRecordsEncloseViewUpdateRecords)
+{
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    menu_trace_clear();
+    // When
+    menu_next();
+    // Then
+    uint16_t records_qty = menu_trace_read(trace_records, MENU_TRACE_BUFFER_SIZE);
+    TEST_ASSERT_EQUAL(MENU_TRACE_NEXT, trace_records[0].event);
+    TEST_ASSERT_EQUAL(0, trace_records[0].level);
+    TEST_ASSERT_EQUAL(0, trace_records[0].index);
+    TEST_ASSERT_EQUAL(MENU_TRACE_UPDATE_VIEW, trace_records[1].event);
+    TEST_ASSERT_EQUAL(1, trace_records[1].index);
+    TEST_ASSERT_EQUAL(MENU_TRACE_UPDATE_VIEW | MENU_TRACE_END_FLAG, trace_records[records_qty - 2U].event);
+    TEST_ASSERT_EQUAL(MENU_TRACE_NEXT | MENU_TRACE_END_FLAG, trace_records[records_qty - 1U].event);
+    TEST_ASSERT_EQUAL(1, trace_records[records_qty - 1U].index);
+}
+
+TEST(menu_lib_trace, GivenMenuViewInitWhenMenuNextCalledThenEveryDriverCallIsRecorded)
+{
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    menu_trace_clear();
+    mock_reset_driver_call_counters();
+    // When
+    menu_next();
+    // Then
+    uint16_t records_qty = menu_trace_read(trace_records, MENU_TRACE_BUFFER_SIZE);
+    TEST_ASSERT_TRUE(records_qty < MENU_TRACE_BUFFER_SIZE);
+    TEST_ASSERT_EQUAL(mock_cursor_position_call_counter, count_trace_records(records_qty, MENU_TRACE_DRV_CURSOR_POSITION));
+    TEST_ASSERT_EQUAL(mock_print_string_call_counter, count_trace_records(records_qty, MENU_TRACE_DRV_PRINT_STRING));
+    TEST_ASSERT_EQUAL(mock_print_char_call_counter, count_trace_records(records_qty, MENU_TRACE_DRV_PRINT_CHAR));
+}
+
+TEST(menu_lib_trace, GivenTickSourceSetWhenMenuNextCalledThenRecordsAreTimestampedWithTicks)
+{
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    menu_trace_clear();
+    menu_trace_set_tick_source(mock_get_tick);
+    // When
+    menu_next();
+    // Then
+    uint16_t records_qty = menu_trace_read(trace_records, MENU_TRACE_BUFFER_SIZE);
+    TEST_ASSERT_EQUAL(1, trace_records[0].timestamp);
+    TEST_ASSERT_EQUAL(records_qty, trace_records[records_qty - 1U].timestamp);
+}
+
+TEST(menu_lib_trace, GivenItemWithChildSelectedWhenMenuEnterCalledThenEnterEndRecordCarriesSubmenuLevel)
+{
+    // Given
+    menu_init();
+    menu_view_init(&mock_menu_1, NULL, NULL);
+    menu_next();
+    menu_trace_clear();
+    // When
+    menu_enter();
+    // Then
+    uint16_t records_qty = menu_trace_read(trace_records, MENU_TRACE_BUFFER_SIZE);
+    TEST_ASSERT_EQUAL(MENU_TRACE_ENTER, trace_records[0].event);
+    TEST_ASSERT_EQUAL(0, trace_records[0].level);
+    TEST_ASSERT_EQUAL(1, trace_records[0].index);
+    TEST_ASSERT_EQUAL(MENU_TRACE_ENTER | MENU_TRACE_END_FLAG, trace_records[records_qty - 1U].event);
+    TEST_ASSERT_EQUAL(1, trace_records[records_qty - 1U].level);
+    TEST_ASSERT_EQUAL(0, trace_records[records_qty - 1U].index);
+}
+
+TEST(menu_lib_trace, GivenMoreRecordsThanBufferSizeWhenMenuTraceReadCalledThenNewestRecordsAreReturnedOldestFirst)
+{
+    // Given
+    for (uint16_t i = 0U; i < (MENU_TRACE_BUFFER_SIZE + 10U); i++)
+    {
+        menu_trace_record(0x40U, 0U, i);
+    }
+    // When
+    uint16_t records_qty = menu_trace_read(trace_records, MENU_TRACE_BUFFER_SIZE);
+    // Then
+    TEST_ASSERT_EQUAL(MENU_TRACE_BUFFER_SIZE, records_qty);
+    TEST_ASSERT_EQUAL(10, trace_records[0].index);
+    TEST_ASSERT_EQUAL(MENU_TRACE_BUFFER_SIZE + 9U, trace_records[MENU_TRACE_BUFFER_SIZE - 1U].index);
+}
+
+TEST(menu_lib_trace, GivenTwoRecordsWhenMenuTraceDumpCalledThenHeaderAndLittleEndianRecordsAreWritten)
+{
+    const uint8_t expected_dump[24] = {
+        'M', 'T', 'R', 'C', 1, 8, 2, 0,
+        MENU_TRACE_NEXT, 1, 0x34, 0x12, 0x01, 0x00, 0x00, 0x00,
+        MENU_TRACE_NEXT | MENU_TRACE_END_FLAG, 1, 0x35, 0x12, 0x02, 0x00, 0x00, 0x00};
+    // Given
+    menu_trace_set_tick_source(mock_get_tick);
+    menu_trace_record(MENU_TRACE_NEXT, 1U, 0x1234U);
+    menu_trace_record(MENU_TRACE_NEXT | MENU_TRACE_END_FLAG, 1U, 0x1235U);
+    // When
+    menu_trace_dump(mock_dump_write);
+    // Then
+    TEST_ASSERT_EQUAL(sizeof(expected_dump), dump_len);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected_dump, dump_buffer, sizeof(expected_dump));
+}
+
+TEST(menu_lib_trace, GivenRecordsWrittenWhenMenuTraceClearCalledThenNoRecordIsRead)
+{
+    // Given
+    menu_trace_record(MENU_TRACE_NEXT, 0U, 0U);
+    menu_trace_record(MENU_TRACE_PREV, 0U, 0U);
+    // When
+    menu_trace_clear();
+    // Then
+    TEST_ASSERT_EQUAL(0, menu_trace_read(trace_records, MENU_TRACE_BUFFER_SIZE));
+}
+
+static uint32_t mock_get_tick(void)
+{
+    mock_tick++;
+    return mock_tick;
+}
+
+static void mock_dump_write(const uint8_t *data, uint16_t len)
+{
+    for (uint16_t i = 0U; (i < len) && (dump_len < DUMP_BUFFER_SIZE); i++)
+    {
+        dump_buffer[dump_len] = data[i];
+        dump_len++;
+    }
+}
+
+static uint16_t count_trace_records(uint16_t records_qty, uint8_t event)
+{
+    uint16_t events_qty = 0U;
+
+    for (uint16_t i = 0U; i < records_qty; i++)
+    {
+        if (trace_records[i].event == event)
+        {
+            events_qty++;
+        }
+    }
+
+    return events_qty;
+}
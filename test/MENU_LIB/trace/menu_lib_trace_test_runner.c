@@ -0,0 +1,13 @@
+#include "unity/fixture/unity_fixture.h"
+
+TEST_GROUP_RUNNER(menu_lib_trace)
+{
+    /* Trace hooks Test cases to run */
+    RUN_TEST_CASE(menu_lib_trace, GivenMenuViewInitWhenMenuNextCalledThenNextRecordsEncloseViewUpdateRecords);
+    RUN_TEST_CASE(menu_lib_trace, GivenMenuViewInitWhenMenuNextCalledThenEveryDriverCallIsRecorded);
+    RUN_TEST_CASE(menu_lib_trace, GivenTickSourceSetWhenMenuNextCalledThenRecordsAreTimestampedWithTicks);
+    RUN_TEST_CASE(menu_lib_trace, GivenItemWithChildSelectedWhenMenuEnterCalledThenEnterEndRecordCarriesSubmenuLevel);
+    RUN_TEST_CASE(menu_lib_trace, GivenMoreRecordsThanBufferSizeWhenMenuTraceReadCalledThenNewestRecordsAreReturnedOldestFirst);
+    RUN_TEST_CASE(menu_lib_trace, GivenTwoRecordsWhenMenuTraceDumpCalledThenHeaderAndLittleEndianRecordsAreWritten);
+    RUN_TEST_CASE(menu_lib_trace, GivenRecordsWrittenWhenMenuTraceClearCalledThenNoRecordIsRead);
+}
@@ -0,0 +1,40 @@
+/**
+ * @file menu.h
+ * @author niwciu (niwciu@gmail.com)
+ * @brief Menu configuration for the virtual list unit tests.
+ * @version 1.0.0
+ * @date 2025-11-24
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#ifndef MENU_USE_VIRTUAL_LISTS
+#define MENU_USE_VIRTUAL_LISTS
+#endif
+
+#include "menu_lib_type.h"
+
+#define MAX_MENU_DEPTH 3
+
+#define MOCK_LOG_ENTRIES_QTY 1000U
+
+typedef enum
+{
+    CB_STATUS_UNKNOWN,
+    CB_EXECUTED,
+} mock_cb_status_e;
+
+extern const menu_t mock_menu_logs;
+extern const menu_t mock_menu_settings;
+extern const menu_t mock_menu_empty_list;
+extern const menu_t mock_sub_menu_contrast;
+extern const menu_t mock_menu_list_with_child;
+extern const menu_t mock_sub_menu_list_child;
+
+extern uint16_t mock_log_get_name_call_counter;
+extern uint16_t mock_log_selected_index;
+extern mock_cb_status_e mock_log_on_select_status;
+
+void mock_reset_log_list_provider(void);
@@ -0,0 +1,218 @@
+#include "unity/fixture/unity_fixture.h"
+#include "menu_lib.h"
+#include "mock_menu_screen_driver_interface.h"
+#include <stddef.h>
+
+TEST_GROUP(menu_lib_virtual_list);
+
+TEST_SETUP(menu_lib_virtual_list)
+{
+    /* Init before every test */
+    init_mock_screen_driver();
+    mock_reset_log_list_provider();
+    menu_init();
+    menu_view_init(&mock_menu_logs, NULL, NULL);
+}
+
+TEST_TEAR_DOWN(menu_lib_virtual_list)
+{
+    /* Cleanup after every test */
+    init_mock_screen_driver();
+}
+
+TEST(menu_lib_virtual_list, GivenMenuViewInitWithVirtualListItemWhenMenuEnterCalledThenScreenContentIsEqualToExpected)
+{
+    const char *expected_screen[4] = {
+        "------- logs -------",
+        ">log_0000           ",
+        " log_0001           ",
+        " log_0002           "};
+    // When
+    menu_enter();
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_virtual_list, GivenMenuViewInitWithVirtualListItemWhenMenuEnterCalledThenOnlyVisibleEntryNamesAreFetched)
+{
+    // When
+    menu_enter();
+    // Then
+    TEST_ASSERT_EQUAL(LCD_Y - 1, mock_log_get_name_call_counter);
+}
+
+TEST(menu_lib_virtual_list, GivenRowWriteDriverAndVirtualListEnteredWhenMenuMoveBy500CalledThenScreenContentIsEqualToExpected)
+{
+    const char *expected_screen[4] = {
+        "------- logs -------",
+        " log_0498           ",
+        " log_0499           ",
+        ">log_0500           "};
+    // Given
+    init_mock_row_screen_driver();
+    menu_init();
+    menu_view_init(&mock_menu_logs, NULL, NULL);
+    menu_enter();
+    mock_reset_log_list_provider();
+    // When
+    menu_move_by(500);
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+    TEST_ASSERT_EQUAL(LCD_Y - 1, mock_log_get_name_call_counter);
+}
+
+TEST(menu_lib_virtual_list, GivenVirtualListEnteredWhenMenuLastCalledThenScreenContentIsEqualToExpected)
+{
+    const char *expected_screen[4] = {
+        "------- logs -------",
+        " log_0997           ",
+        " log_0998           ",
+        ">log_0999           "};
+    // Given
+    menu_enter();
+    // When
+    menu_last();
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_virtual_list, GivenVirtualListLastEntrySelectedWhenMenuNextCalledThenNoDriverCall)
+{
+    // Given
+    menu_enter();
+    menu_last();
+    mock_reset_driver_call_counters();
+    // When
+    menu_next();
+    // Then
+    TEST_ASSERT_EQUAL(0, mock_cursor_position_call_counter);
+    TEST_ASSERT_EQUAL(0, mock_print_char_call_counter);
+}
+
+TEST(menu_lib_virtual_list, GivenVirtualListLastEntrySelectedWhenMenuFirstCalledThenScreenContentIsEqualToExpected)
+{
+    const char *expected_screen[4] = {
+        "------- logs -------",
+        ">log_0000           ",
+        " log_0001           ",
+        " log_0002           "};
+    // Given
+    menu_enter();
+    menu_last();
+    // When
+    menu_first();
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_virtual_list, GivenVirtualListEnteredWhenMenuPageDownAndMenuPrevCalledThenScreenContentIsEqualToExpected)
+{
+    const char *expected_screen[4] = {
+        "------- logs -------",
+        " log_0001           ",
+        ">log_0002           ",
+        " log_0003           "};
+    // Given
+    menu_enter();
+    // When
+    menu_page_down();
+    menu_prev();
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_virtual_list, GivenVirtualListEnteredAndMenuMoveBy5CalledWhenMenuEnterCalledThenOnSelectIsCalledWithEntryIndex)
+{
+    // Given
+    menu_enter();
+    menu_move_by(5);
+    // When
+    menu_enter();
+    // Then
+    TEST_ASSERT_EQUAL(CB_EXECUTED, mock_log_on_select_status);
+    TEST_ASSERT_EQUAL(5, mock_log_selected_index);
+}
+
+TEST(menu_lib_virtual_list, GivenVirtualListEnteredWhenMenuEscCalledThenListOwnerIsSelectedAndScreenContentIsEqualToExpected)
+{
+    const char *expected_screen[4] = {
+        "------- MENU -------",
+        ">logs               ",
+        " settings           ",
+        " empty              "};
+    // Given
+    menu_enter();
+    menu_move_by(20);
+    // When
+    menu_esc();
+    // Then
+    TEST_ASSERT_EQUAL(&mock_menu_logs, get_current_menu_position());
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_virtual_list, GivenEmptyVirtualListItemSelectedWhenMenuEnterCalledThenScreenContentIsEqualToExpected)
+{
+    const char *expected_screen[4] = {
+        "------ empty -------",
+        ">                   ",
+        "                    ",
+        "                    "};
+    // Given
+    menu_last();
+    // When
+    menu_enter();
+    menu_next();
+    menu_enter();
+    // Then
+    TEST_ASSERT_EQUAL_STRING_ARRAY(expected_screen, mock_screen_lines, LCD_Y);
+}
+
+TEST(menu_lib_virtual_list, GivenVirtualListEnteredAndIncrementalRenderModeWhenMenuNextCalledWithoutScrollThenNoEntryNameIsFetched)
+{
+    // Given
+    menu_set_render_mode(MENU_RENDER_INCREMENTAL);
+    menu_enter();
+    mock_reset_log_list_provider();
+    // When
+    menu_next();
+    // Then
+    TEST_ASSERT_EQUAL(0, mock_log_get_name_call_counter);
+    TEST_ASSERT_EQUAL_STRING(">log_0001           ", mock_screen_lines[2]);
+}
+
+TEST(menu_lib_virtual_list, GivenVirtualListEnteredAndEventsPostedWhenMenuProcessCalledThenOnSelectIsCalledWithEntryIndex)
+{
+    // Given
+    menu_enter();
+    menu_post_event(MENU_EVENT_NEXT);
+    menu_post_event(MENU_EVENT_NEXT);
+    menu_post_event(MENU_EVENT_NEXT);
+    menu_post_event(MENU_EVENT_ENTER);
+    // When
+    menu_process();
+    // Then
+    TEST_ASSERT_EQUAL(CB_EXECUTED, mock_log_on_select_status);
+    TEST_ASSERT_EQUAL(3, mock_log_selected_index);
+}
+
+TEST(menu_lib_virtual_list, GivenSettingsSubMenuEnteredAndLeftWhenVirtualListEnteredThenHeaderShowsListOwnerName)
+{
+    // Given
+    menu_next();
+    menu_enter();
+    menu_esc();
+    menu_prev();
+    // When
+    menu_enter();
+    // Then
+    TEST_ASSERT_EQUAL_STRING("------- logs -------", mock_screen_lines[0]);
+}
+
+TEST(menu_lib_virtual_list, GivenVirtualListItemWithSubmenuWhenMenuViewInitCalledThenReturnMalformedMenu)
+{
+    // When
+    menu_status_t status = menu_view_init(&mock_menu_list_with_child, NULL, NULL);
+    // Then
+    TEST_ASSERT_EQUAL(MENU_ERR_MALFORMED_MENU, status);
+    TEST_ASSERT_EQUAL(&mock_menu_logs, get_current_menu_position());
+}
@@ -0,0 +1,22 @@
+#include "unity/fixture/unity_fixture.h"
+
+TEST_GROUP_RUNNER(menu_lib_virtual_list)
+{
+    /* Virtual list view Test cases to run */
+    RUN_TEST_CASE(menu_lib_virtual_list, GivenMenuViewInitWithVirtualListItemWhenMenuEnterCalledThenScreenContentIsEqualToExpected);
+    RUN_TEST_CASE(menu_lib_virtual_list, GivenMenuViewInitWithVirtualListItemWhenMenuEnterCalledThenOnlyVisibleEntryNamesAreFetched);
+    RUN_TEST_CASE(menu_lib_virtual_list, GivenRowWriteDriverAndVirtualListEnteredWhenMenuMoveBy500CalledThenScreenContentIsEqualToExpected);
+    RUN_TEST_CASE(menu_lib_virtual_list, GivenVirtualListEnteredWhenMenuLastCalledThenScreenContentIsEqualToExpected);
+    RUN_TEST_CASE(menu_lib_virtual_list, GivenVirtualListLastEntrySelectedWhenMenuNextCalledThenNoDriverCall);
+    RUN_TEST_CASE(menu_lib_virtual_list, GivenVirtualListLastEntrySelectedWhenMenuFirstCalledThenScreenContentIsEqualToExpected);
+    RUN_TEST_CASE(menu_lib_virtual_list, GivenVirtualListEnteredWhenMenuPageDownAndMenuPrevCalledThenScreenContentIsEqualToExpected);
+    RUN_TEST_CASE(menu_lib_virtual_list, GivenEmptyVirtualListItemSelectedWhenMenuEnterCalledThenScreenContentIsEqualToExpected);
+    RUN_TEST_CASE(menu_lib_virtual_list, GivenVirtualListEnteredAndIncrementalRenderModeWhenMenuNextCalledWithoutScrollThenNoEntryNameIsFetched);
+    /* Virtual list selection Test cases to run */
+    RUN_TEST_CASE(menu_lib_virtual_list, GivenVirtualListEnteredAndMenuMoveBy5CalledWhenMenuEnterCalledThenOnSelectIsCalledWithEntryIndex);
+    RUN_TEST_CASE(menu_lib_virtual_list, GivenVirtualListEnteredWhenMenuEscCalledThenListOwnerIsSelectedAndScreenContentIsEqualToExpected);
+    RUN_TEST_CASE(menu_lib_virtual_list, GivenVirtualListEnteredAndEventsPostedWhenMenuProcessCalledThenOnSelectIsCalledWithEntryIndex);
+    RUN_TEST_CASE(menu_lib_virtual_list, GivenSettingsSubMenuEnteredAndLeftWhenVirtualListEnteredThenHeaderShowsListOwnerName);
+    /* Virtual list validation Test cases to run */
+    RUN_TEST_CASE(menu_lib_virtual_list, GivenVirtualListItemWithSubmenuWhenMenuViewInitCalledThenReturnMalformedMenu);
+}
@@ -0,0 +1,72 @@
+/**
+ * @file mock_virtual_menu.c
+ * @author niwciu (niwciu@gmail.com)
+ * @brief Menu with virtual lists used by the virtual list unit tests.
+ * @version 1.0.0
+ * @date 2025-11-24
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include "menu.h"
+
+#include <stddef.h>
+#include <stdio.h>
+
+uint16_t mock_log_get_name_call_counter = 0U;
+uint16_t mock_log_selected_index = 0U;
+mock_cb_status_e mock_log_on_select_status = CB_STATUS_UNKNOWN;
+
+static uint16_t mock_log_count(void);
+static void mock_log_get_name(uint16_t index, char *buf, uint8_t len);
+static void mock_log_on_select(uint16_t index);
+static uint16_t mock_empty_list_count(void);
+static void mock_empty_list_get_name(uint16_t index, char *buf, uint8_t len);
+
+static const menu_list_provider_t mock_log_list = {mock_log_count, mock_log_get_name, mock_log_on_select};
+static const menu_list_provider_t mock_empty_list = {mock_empty_list_count, mock_empty_list_get_name, NULL};
+
+const menu_t mock_menu_logs = {"logs", &mock_menu_settings, NULL, NULL, NULL, NULL, &mock_log_list};
+const menu_t mock_menu_settings = {"settings", &mock_menu_empty_list, &mock_menu_logs, &mock_sub_menu_contrast, NULL, NULL, NULL};
+const menu_t mock_sub_menu_contrast = {"contrast", NULL, NULL, NULL, &mock_menu_settings, NULL, NULL};
+const menu_t mock_menu_empty_list = {"empty", NULL, &mock_menu_settings, NULL, NULL, NULL, &mock_empty_list};
+
+/* Malformed: an item with a virtual list must not have a submenu */
+const menu_t mock_menu_list_with_child = {"broken", NULL, NULL, &mock_sub_menu_list_child, NULL, NULL, &mock_log_list};
+const menu_t mock_sub_menu_list_child = {"child", NULL, NULL, NULL, &mock_menu_list_with_child, NULL, NULL};
+
+void mock_reset_log_list_provider(void)
+{
+    mock_log_get_name_call_counter = 0U;
+    mock_log_selected_index = 0U;
+    mock_log_on_select_status = CB_STATUS_UNKNOWN;
+}
+
+static uint16_t mock_log_count(void)
+{
+    return MOCK_LOG_ENTRIES_QTY;
+}
+
+static void mock_log_get_name(uint16_t index, char *buf, uint8_t len)
+{
+    mock_log_get_name_call_counter++;
+    (void)snprintf(buf, len, "log_%04u", (unsigned int)index);
+}
+
+static void mock_log_on_select(uint16_t index)
+{
+    mock_log_selected_index = index;
+    mock_log_on_select_status = CB_EXECUTED;
+}
+
+static uint16_t mock_empty_list_count(void)
+{
+    return 0U;
+}
+
+static void mock_empty_list_get_name(uint16_t index, char *buf, uint8_t len)
+{
+    (void)index;
+    (void)buf;
+    (void)len;
+}